@@ -5,7 +5,16 @@
 #ifndef RVM_RA_UTILS_H
 #define RVM_RA_UTILS_H
 
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <deque>
 #include <map>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
 
 namespace utils {
 
@@ -134,22 +143,93 @@ namespace utils {
     struct Pos {
     public:
         Pos() = default;
-        Pos(int line, int column, std::string filepath);
+        Pos(int line, int column, std::string_view filepath);
         [[nodiscard]] int getLine() const;
         [[nodiscard]] int getColumn() const;
-        [[nodiscard]] std::string getFilepath() const;
+        [[nodiscard]] const std::string &getFilepath() const;
         [[nodiscard]] std::string getFilePosStr() const;
         friend std::ostream& operator<<(std::ostream& out, const Pos& pos);
         [[nodiscard]] std::string toString() const;
         void serialize(std::ostream& out, const SerializationProfile &profile) const;
         void deserialize(std::istream& in, const SerializationProfile &profile);
+
+        // ·ڵǰ߳ϿλϢļ·ڱŶдÿ·ֻ״γʱд
+        class PathTable {
+        public:
+            class Scope {
+            public:
+                Scope();
+                ~Scope();
+                Scope(const Scope &) = delete;
+                Scope &operator=(const Scope &) = delete;
+            private:
+                std::unique_ptr<PathTable> table_;
+                PathTable *previous_;
+            };
+
+            void writePath(std::ostream &out, const std::string *filepath);
+            const std::string *readPath(std::istream &in);
+        private:
+            static constexpr uint32_t NO_PATH = static_cast<uint32_t>(-1);
+            std::vector<const std::string *> paths_;
+            std::unordered_map<const std::string *, uint32_t> index_;
+
+            static thread_local PathTable *current_;
+            friend struct Pos;
+        };
     private:
         int line{0};
         int column{0};
-        std::string filepath{};
+        const std::string *filepath{nullptr}; // ָפļ·ͬһļλùһ·Ϊ nullptr ʱʾ·
+        static const std::string *internFilepath(std::string_view filepath);
+    };
+
+    // === פ ===
+    // ΨһıʶפͬƶӦͬķűţڽڱЧ
+    using Symbol = uint32_t;
+
+    struct SymbolTable {
+    public:
+        static constexpr Symbol NO_SYMBOL = static_cast<Symbol>(-1);
+        static Symbol intern(std::string_view name);
+        static const std::string &getName(Symbol symbol);
+        static size_t size();
+    private:
+        static SymbolTable &getInstance();
+        std::deque<std::string> names_; // deque ʱƶԪأindex_ е string_view Ч
+        std::unordered_map<std::string_view, Symbol> index_;
+        std::mutex mutex_;
+    };
+
+    // === ı ===
+    // ַı̵߳ǰıУıϲĳڴУڴеָͬڣ
+    // ʶؼֱֲ÷űפƣı
+    class ArgTextTable {
+    public:
+        // ڵǰ߳Ͽıʱָ֮ǰı
+        class Scope {
+        public:
+            explicit Scope(ArgTextTable &table);
+            ~Scope();
+            Scope(const Scope &) = delete;
+            Scope &operator=(const Scope &) = delete;
+        private:
+            ArgTextTable *previous_;
+        };
+
+        explicit ArgTextTable(std::pmr::memory_resource *resource) : texts_(resource) {}
+
+        // ı뵱ǰıصָıͷǰЧδıʱ׳쳣
+        static const std::string *add(std::string text);
+
+    private:
+        std::pmr::deque<std::string> texts_; // deque ʱƶԪأеָ뱣Ч
+
+        static thread_local ArgTextTable *current_;
     };
 
     // ===  ===
+    // ֻıָ룬Ʋı
     struct Arg {
     public:
         Arg() = default;
@@ -158,14 +238,19 @@ namespace utils {
         [[nodiscard]] const Pos &getPos() const;
         [[nodiscard]] ArgType getType() const;
         [[nodiscard]] const std::string &getValue() const;
+        // ʶؼֲפţΪ SymbolTable::NO_SYMBOL
+        [[nodiscard]] Symbol getSymbol() const;
         [[nodiscard]] std::string toString() const;
         [[nodiscard]] std::string getPosStr() const;
         void serialize(std::ostream& out, const SerializationProfile &profile) const;
         void deserialize(std::istream& in, const SerializationProfile &profile);
     private:
         Pos pos{};
+        const std::string *value{nullptr}; // ָűеƻıеıΪ nullptr ʱʾı
         utils::ArgType type{};
-        std::string value;
+        Symbol symbol{SymbolTable::NO_SYMBOL}; // л뷴лʱפ
+
+        void setValue(std::string text);
     };
 
     // === в ===
@@ -312,6 +397,132 @@ namespace utils {
     int getRandomInt(int min, int max);
     double getRandomFloat(double min, double max, int decimalPlaces = 6);
 
+    // === ϣ ===
+    // FNV-1a ϣignore_case Ϊ true ʱ ASCII д۵
+    constexpr uint32_t hashName(const std::string_view name, const uint32_t seed, const bool ignore_case) {
+        uint32_t hash = 2166136261u ^ (seed * 16777619u);
+        for (const char c: name) {
+            const char ch = ignore_case && c >= 'a' && c <= 'z' ? static_cast<char>(c - 'a' + 'A') : c;
+            hash ^= static_cast<unsigned char>(ch);
+            hash *= 16777619u;
+        }
+        return hash;
+    }
+
+    constexpr bool equalName(const std::string_view lhs, const std::string_view rhs, const bool ignore_case) {
+        if (lhs.size() != rhs.size()) {
+            return false;
+        }
+        for (size_t i = 0; i < lhs.size(); ++i) {
+            char l = lhs[i], r = rhs[i];
+            if (ignore_case) {
+                l = l >= 'a' && l <= 'z' ? static_cast<char>(l - 'a' + 'A') : l;
+                r = r >= 'a' && r <= 'z' ? static_cast<char>(r - 'a' + 'A') : r;
+            }
+            if (l != r) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // PerfectHashTable ࣺڹϣhash-and-displace
+    //  0 ͰɴСΪÿͰѰʹмղ۵λӣ
+    // ѯֻιϣȽһμڴ档뻥ͬ޷ڱɹ
+    template<typename Value, size_t N, bool IgnoreCase = false>
+    class PerfectHashTable {
+        static_assert(N > 0 && N < 0xFFFF, "PerfectHashTable requires 1 to 65534 entries");
+    public:
+        struct Entry {
+            std::string_view key{};
+            Value value{};
+        };
+
+        consteval explicit PerfectHashTable(const std::array<Entry, N> &entries) : entries_(entries) {
+            std::array<size_t, N> bucket_of{};
+            std::array<size_t, BUCKET_COUNT> bucket_sizes{};
+            for (size_t i = 0; i < N; ++i) {
+                bucket_of[i] = hashName(entries_[i].key, 0, IgnoreCase) % BUCKET_COUNT;
+                ++bucket_sizes[bucket_of[i]];
+            }
+            std::array<size_t, BUCKET_COUNT> order{};
+            for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+                order[i] = i;
+            }
+            for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+                for (size_t j = i + 1; j < BUCKET_COUNT; ++j) {
+                    if (bucket_sizes[order[j]] > bucket_sizes[order[i]]) {
+                        const size_t tmp = order[i];
+                        order[i] = order[j];
+                        order[j] = tmp;
+                    }
+                }
+            }
+            slots_.fill(EMPTY_SLOT);
+            for (const size_t bucket: order) {
+                if (bucket_sizes[bucket] == 0) {
+                    break;
+                }
+                for (uint32_t seed = 1;; ++seed) {
+                    std::array<size_t, N> candidate{};
+                    size_t count = 0;
+                    bool placed = true;
+                    for (size_t i = 0; i < N && placed; ++i) {
+                        if (bucket_of[i] != bucket) {
+                            continue;
+                        }
+                        const size_t slot = hashName(entries_[i].key, seed, IgnoreCase) % SLOT_COUNT;
+                        placed = slots_[slot] == EMPTY_SLOT;
+                        for (size_t k = 0; k < count && placed; ++k) {
+                            placed = candidate[k] != slot;
+                        }
+                        candidate[count++] = slot;
+                    }
+                    if (placed) {
+                        size_t k = 0;
+                        for (size_t i = 0; i < N; ++i) {
+                            if (bucket_of[i] == bucket) {
+                                slots_[candidate[k++]] = static_cast<uint16_t>(i);
+                            }
+                        }
+                        seeds_[bucket] = seed;
+                        break;
+                    }
+                }
+            }
+        }
+
+        // ؼڹʱĿе±꣬ʱ -1
+        [[nodiscard]] constexpr int indexOf(const std::string_view key) const {
+            const uint32_t seed = seeds_[hashName(key, 0, IgnoreCase) % BUCKET_COUNT];
+            const uint16_t index = slots_[hashName(key, seed, IgnoreCase) % SLOT_COUNT];
+            if (index == EMPTY_SLOT || !equalName(entries_[index].key, key, IgnoreCase)) {
+                return -1;
+            }
+            return index;
+        }
+
+        [[nodiscard]] constexpr const Value *find(const std::string_view key) const {
+            const int index = indexOf(key);
+            return index == -1 ? nullptr : &entries_[index].value;
+        }
+
+        [[nodiscard]] constexpr bool contains(const std::string_view key) const {
+            return find(key) != nullptr;
+        }
+
+        [[nodiscard]] constexpr const std::array<Entry, N> &entries() const { return entries_; }
+
+    private:
+        static constexpr uint16_t EMPTY_SLOT = 0xFFFF;
+        static constexpr size_t SLOT_COUNT = std::bit_ceil(N * 2);
+        static constexpr size_t BUCKET_COUNT = N / 2 + 1;
+
+        std::array<Entry, N> entries_{};
+        std::array<uint32_t, BUCKET_COUNT> seeds_{};
+        std::array<uint16_t, SLOT_COUNT> slots_{};
+    };
+
 } // utils
 
 #endif //RVM_RA_UTILS_H
\ No newline at end of file
@@ -5,6 +5,7 @@
 #ifndef RVM_RA_BASE_H
 #define RVM_RA_BASE_H
 
+#include <csignal>
 #include <iostream>
 #include <sstream>
 #include <unordered_map>
@@ -13,11 +14,13 @@
 #include <fstream>
 #include <functional>
 #include <mutex>
+#include <atomic>
 #include <thread>
 #include <condition_variable>
 #include <list>
 #include <unordered_set>
 #include <stack>
+#include <utility>
 #include "lib/ra_utils.h"
 #include "rvm_version.h"
 
@@ -79,14 +82,19 @@ namespace base {
         uint16_t major_ver;
         uint16_t minor_ver;
         uint16_t patch_ver;
-        uint16_t profile;
+        uint8_t profile;
+        uint8_t flags; // 旧版本文件中该字节恒为 0
+
+        static constexpr uint8_t FLAG_VERIFIED = 0x01; // 指令集已通过静态校验
+        static constexpr uint8_t FLAG_PATH_TABLE = 0x02; // 位置信息的文件路径按路径表编号写出
 
         explicit RVMSerialHeader(const utils::SerializationProfile &profile = utils::SerializationProfile::Debug)
                 : magic{'R', 'S', 'I', 0x1A},
                   major_ver(VERSION_MAJOR),
                   minor_ver(VERSION_MINOR),
                   patch_ver(VERSION_PATCH),
-                  profile(static_cast<uint16_t>(profile)) {}
+                  profile(static_cast<uint8_t>(profile)),
+                  flags(0) {}
 
         void serialize(std::ostream &out) const;
 
@@ -99,6 +107,14 @@ namespace base {
 
         void setProfile(const utils::SerializationProfile &profile_);
 
+        [[nodiscard]] bool isVerified() const;
+
+        void setVerified(const bool &verified);
+
+        [[nodiscard]] bool hasPathTable() const;
+
+        void setPathTable(const bool &path_table);
+
         static std::string getRVMVersionInfo();
 
         [[nodiscard]] std::string getRSIVersionInfo(const std::string &path) const;
@@ -110,11 +126,36 @@ namespace base {
 
     extern RVMSerialHeader rvm_serial_header;
 
+    // ThreadBound 模板：按线程绑定的虚拟机状态
+    // 每个虚拟机持有一份 State，并在运行它的线程上绑定；访问者通过 current() 取得当前线程绑定的实例，
+    // 未绑定时退回进程级的默认实例，使不显式创建虚拟机的调用者保持原有行为
+    template<typename State>
+    struct ThreadBound {
+        [[nodiscard]] static State &current() { return bound_ ? *bound_ : fallback(); }
+
+        // 绑定新实例并返回之前绑定的实例，传入 nullptr 时恢复为默认实例
+        static State *bind(State *state) { return std::exchange(bound_, state); }
+
+    private:
+        static State &fallback() {
+            // 不析构，以免静态对象析构时访问已销毁的实例
+            static auto *instance = new State();
+            return *instance;
+        }
+
+        static inline thread_local State *bound_ = nullptr;
+    };
+
+    // WorkingDirectories 结构体：程序工作目录栈，执行文件时压入其所在目录
+    struct WorkingDirectories {
+        std::stack<std::string> stack;
+    };
+
     extern const std::string PROGRAM_RVM_DIRECTORY; // RVM working directory
     extern const std::string PROGRAM_ENVIRONMENT_DIRECTORY; // Command line working directory
-    extern std::stack<std::string> PROGRAM_WORKING_DIRECTORY_STACK; // Program working directory
+    std::stack<std::string> &getProgramWorkingDirectoryStack(); // Program working directory of the bound VM
 
-    extern bool PROGRAM_INTERRUPTED;
+    extern volatile std::sig_atomic_t PROGRAM_INTERRUPTED; // 由 SIGINT 信号处理函数置位，在输入与执行安全点处检查
 
     enum class IDType;
 
@@ -166,7 +207,7 @@ namespace base {
         virtual ~RVM_ID() = default;
 
     private:
-        static int counter;
+        static std::atomic<int> counter; // 多个虚拟机可在不同线程上同时分配编号
         int uid;
     };
 
@@ -255,6 +296,8 @@ namespace base {
 
     struct RVM_IO {
 
+        explicit RVM_IO(int threshold_size = 20);
+
         RVM_IO(const RVM_IO &) = delete;
 
         RVM_IO &operator=(const RVM_IO &) = delete;
@@ -340,11 +383,12 @@ namespace base {
         ~RVM_IO();
 
     private:
-        static RVM_IO *instance;
         std::stringstream buffer;
         std::stringstream errorBuffer;
         std::ofstream fileStream;
         std::mutex fileWriteMutex;
+        std::condition_variable fileWritesDone;
+        size_t pendingFileWrites{0}; // 已提交到线程池但尚未写入文件的输出，关闭文件前需等待写完
         bool toConsole;
         bool toFile;
         size_t bufferThreshold;
@@ -352,7 +396,7 @@ namespace base {
         std::vector<std::string> inputCache;
         RVM_ThreadPool &threadPool = RVM_ThreadPool::getInstance();
 
-        explicit RVM_IO(int threshold_size = 20);
+        void waitFileWrites();
 
         template<typename T>
         static void immediateOutputImpl(std::ostream &os, const T &arg) {
@@ -381,6 +425,8 @@ namespace base {
         FieldError,
         RecursionError,
         LinkError,
+        TimeoutError,
+        InterruptError,
         UnknownError,
         CustomError
     };
@@ -529,6 +575,22 @@ namespace base {
             }
         };
 
+        struct TimeoutError final : RVM_Error {
+            TimeoutError(const std::string& error_position, const std::string& error_line,
+                         std::vector<std::string> error_info, const std::vector<std::string>& repair_tips)
+                    : RVM_Error(ErrorType::TimeoutError, error_position, error_line,
+                                {"This error is caused by the program exceeding its execution budget."},
+                                repair_tips) {
+                this->error_info.insert(this->error_info.end(), error_info.begin(), error_info.end());
+            }
+        };
+
+        struct InterruptError final : RVM_Error {
+            InterruptError(const std::string& error_position, const std::string& error_line)
+                    : RVM_Error(ErrorType::InterruptError, error_position, error_line,
+                                {"This error is caused by the program being interrupted by ^C."}, {}) {}
+        };
+
         struct IndexOutOfRangeError final : RVM_Error {
             IndexOutOfRangeError(const std::string& error_position,
                                  const std::string& error_line,
@@ -559,22 +621,31 @@ namespace base {
 
     std::string getKeywordTypeName(const KeywordType &keywordType);
 
-    static std::unordered_map<std::string, std::unordered_set<std::string>> categorizedKeywords{
-            {"IOMode",       {"s-m",  "s-l",   "s-f",   "s-n",   "s-unpack"}},
-            {"Logical",      {"RG",   "RGE",   "RNE",   "RE",    "RAE",   "RGE", "RG", "RT", "RF", "AND", "OR"}},
-            {"MemoryVar",    {"true", "false", "null",  "SN",    "SE",    "SS",  "SR"}},
-            {"DataTypes",    {tp, tp_int, tp_float, tp_str, tp_bool, tp_null,
-                                     tp_char, tp_list, tp_dict, tp_series, tp_pair,
-                                     tp_time, tp_qot, tp_error}},
-            {"FileModes",    {"fl-r", "fl-w",  "fl-rw", "fl-ap", "fl-ra", "fl-wa"}},
-            {"Instructions", {}}
-    };
-
-    void addKeywordInCategory(const KeywordType &category, const std::string &keyword);
-
-    bool containsKeyword(const std::string &keyword);
-
-    bool containsKeywordInCategory(const KeywordType &category, const std::string &keyword);
+    // 关键字表：编译期构建的完美哈希表，关键字 -> 所属分类
+    // 指令名不在此表中，由 RI::getRIByStr 查询指令表
+    using KeywordTable = utils::PerfectHashTable<KeywordType, 43>;
+    inline constexpr KeywordTable keywordTable{{{
+            {"s-m", KeywordType::IOModes}, {"s-l", KeywordType::IOModes}, {"s-f", KeywordType::IOModes},
+            {"s-n", KeywordType::IOModes}, {"s-unpack", KeywordType::IOModes},
+            {"RG", KeywordType::Logical}, {"RGE", KeywordType::Logical}, {"RNE", KeywordType::Logical},
+            {"RE", KeywordType::Logical}, {"RAE", KeywordType::Logical}, {"RLE", KeywordType::Logical},
+            {"RL", KeywordType::Logical}, {"RT", KeywordType::Logical}, {"RF", KeywordType::Logical},
+            {"AND", KeywordType::Logical}, {"OR", KeywordType::Logical},
+            {"true", KeywordType::MemoryVars}, {"false", KeywordType::MemoryVars}, {"null", KeywordType::MemoryVars},
+            {"SN", KeywordType::MemoryVars}, {"SE", KeywordType::MemoryVars}, {"SS", KeywordType::MemoryVars},
+            {"SR", KeywordType::MemoryVars},
+            {tp, KeywordType::DataTypes}, {tp_int, KeywordType::DataTypes}, {tp_float, KeywordType::DataTypes},
+            {tp_str, KeywordType::DataTypes}, {tp_bool, KeywordType::DataTypes}, {tp_null, KeywordType::DataTypes},
+            {tp_char, KeywordType::DataTypes}, {tp_list, KeywordType::DataTypes}, {tp_dict, KeywordType::DataTypes},
+            {tp_series, KeywordType::DataTypes}, {tp_pair, KeywordType::DataTypes}, {tp_time, KeywordType::DataTypes},
+            {tp_qot, KeywordType::DataTypes}, {tp_error, KeywordType::DataTypes},
+            {"fl-r", KeywordType::FileModes}, {"fl-w", KeywordType::FileModes}, {"fl-rw", KeywordType::FileModes},
+            {"fl-ap", KeywordType::FileModes}, {"fl-ra", KeywordType::FileModes}, {"fl-wa", KeywordType::FileModes},
+    }}};
+
+    bool containsKeyword(std::string_view keyword);
+
+    bool containsKeywordInCategory(const KeywordType &category, std::string_view keyword);
 
     std::string getKeywordTypeFormatString(const KeywordType &keywordType);
 
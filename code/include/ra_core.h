@@ -12,6 +12,7 @@
 #include <functional>
 #include <list>
 #include <algorithm>
+#include <atomic>
 #include "ra_base.h"
 #include "lib/ra_utils.h"
 
@@ -61,20 +62,40 @@ namespace core {
 
         };
 
+        // ݱʶƷ 64 λλã | λ | 
+        // λͷŻպ֮ı䣬ɱʶ QuoteCompareGroup еıʶ
         struct DataID final : base::RVM_ID {
-            std::string idstring;
+            static constexpr int SCOPE_BITS = 20;
+            static constexpr int SLOT_BITS = 24;
+            static constexpr int GENERATION_BITS = 20;
+            static constexpr uint32_t MAX_SCOPE_ID = (1u << SCOPE_BITS) - 1;
+            static constexpr uint32_t MAX_SLOT = (1u << SLOT_BITS) - 1;
+            static constexpr uint32_t GENERATION_MASK = (1u << GENERATION_BITS) - 1;
 
             explicit DataID();
 
-            explicit DataID(std::string name, std::string spaceName = "");
+            // κݱʶ
+            explicit DataID(const std::string &name);
+
+            DataID(utils::Symbol symbol, uint32_t scopeId, uint32_t slot, uint32_t generation);
 
             [[nodiscard]] std::string toFullString() const;
 
+            //  name@scope#slot ʶַ
+            [[nodiscard]] std::string getIdString() const;
+
             [[nodiscard]] const std::string &getName() const;
 
-            [[nodiscard]] const std::string &getScopeName() const;
+            [[nodiscard]] utils::Symbol getSymbol() const;
+
+            // ţ0 ʾκ
+            [[nodiscard]] uint32_t getScopeId() const;
+
+            [[nodiscard]] uint32_t getSlot() const;
 
-            [[nodiscard]] size_t getIndex() const;
+            [[nodiscard]] uint32_t getGeneration() const;
+
+            [[nodiscard]] uint64_t getPacked() const;
 
             void printInfo() const override;
 
@@ -83,11 +104,8 @@ namespace core {
             [[nodiscard]] std::string toString() const override;
 
         private:
-            std::string name_;        // Ʋ
-            std::string scopeName_;   // ռ䲿
-            size_t index_ = -1;       // 
-
-            static size_t generateIndex();
+            uint64_t packed_ = 0;
+            utils::Symbol symbol_ = utils::SymbolTable::NO_SYMBOL; // Ƶפ
         };
     }
 
@@ -99,12 +117,157 @@ namespace core {
         struct InsSet;
         struct DetectBlock;
         struct AtmpBlock;
+        struct AtmpLayout;
         using RIID [[maybe_unused]] = id::RIID;
         using InsID = id::InsID;
-        using StdArgs = std::vector<utils::Arg>;
+        using StdArgs = std::pmr::vector<utils::Arg>; // ָĲбָĳڴ
         typedef ExecutionStatus (*ExecutorFunc)(const Ins&, size_t&, const StdArgs&);
     }
 
+    namespace memory {
+        struct Traceable;
+
+        // CycleCollector ṹ壺ݵĻ
+        // ü޷ ListDictKeyValuePairCustomTypeCustomInst ֮乹ɵĻ
+        // ʱüȥǼ֮ڲãʣ 0 ⲿУִջ
+        // Ĵ򱾵֡Ϊǿɴ
+        // ֻڽȫУﵽֵʱǼע߳̽
+        struct CycleCollector {
+            struct Stats {
+                size_t collections{0};
+                size_t freed{0};
+                double total_pause_ms{0};
+                double max_pause_ms{0};
+            };
+
+            // State ṹ壺һĵǼǱͳƣ VMContext в̰߳
+            struct State {
+                std::mutex mutex;
+                std::vector<Traceable *> tracked;
+                size_t allocations{0};
+                size_t next_trigger{0}; // ϴλպԽ࣬´δԽⷴɨ賤ڴ
+                Stats stats;
+            };
+
+            static int threshold; // յΪ 0 ʱرջ
+
+            static void track(Traceable *object);
+
+            static void untrack(Traceable *object);
+
+            // ȫãﵽֵʱһ
+            static void collectIfNeeded();
+
+            // գͷŵ
+            static size_t collect();
+
+            [[nodiscard]] static size_t getTrackedCount();
+
+            [[nodiscard]] static Stats getStats();
+
+            static void printInfo(std::ostream &out = std::cout);
+
+        private:
+            static State &state() { return base::ThreadBound<State>::current(); }
+        };
+
+        // Traceable ṹ壺ܹû
+        // ʵʱǼǵ CycleCollectorʱעtraceChildren ֱӳеݣ
+        // жΪʱ clearChildren Ͽйϵʹϵüͷ
+        struct Traceable : std::enable_shared_from_this<Traceable> {
+            Traceable();
+
+            Traceable(const Traceable &other);
+
+            Traceable &operator=(const Traceable &other);
+
+            virtual ~Traceable();
+
+            virtual void traceChildren(const std::function<void(const base::RVM_Data *)> &visit) const = 0;
+
+            virtual void clearChildren() = 0;
+
+        private:
+            friend struct CycleCollector;
+            size_t tracked_index_{0}; // ڵǼǱе±꣬עʱβ
+            CycleCollector::State *collector_{nullptr}; // ǼڵĻݿڰ߳
+        };
+
+        enum class HeapCategory {
+            String,
+            List,
+            Dict,
+            CustomInst
+        };
+
+        // HeapQuota ṹ壺غɵĶڴ
+        // ַбֵĴ洢Զʵֶ HeapAccount غɴСˡ
+        // ﵽֵޣδʱΪӲޣʱڴѹһִаȫջ
+        // պԳӲ׳ɱ MemoryErrorֻ޸ԭӼڷ䴦׳쳣
+        struct HeapQuota {
+            static constexpr size_t NO_TRIGGER = static_cast<size_t>(-1);
+            static constexpr size_t CATEGORY_COUNT = 4;
+
+            // State ṹ壺һغ VMContext в̰߳
+            struct State {
+                std::atomic<size_t> usage{0};
+                std::atomic<size_t> peak{0};
+                std::atomic<size_t> trigger{NO_TRIGGER};
+                std::atomic<bool> pressure{false};
+                std::atomic<size_t> category_usage[CATEGORY_COUNT]{};
+            };
+
+            static int soft_limit_mb; // ޣMBΪ 0 ʱ
+            static int hard_limit_mb; // ӲޣMBΪ 0 ʱ
+
+            [[nodiscard]] static State &current() { return base::ThreadBound<State>::current(); }
+
+            // ǰ趨ʼʱ
+            static void start();
+
+            static void adjust(State &state, HeapCategory category, size_t old_bytes, size_t new_bytes);
+
+            [[nodiscard]] static bool underPressure() { return current().pressure.load(std::memory_order_relaxed); }
+
+            // ȫãջ趨ǷӲ֮
+            static bool relieve();
+
+            [[nodiscard]] static size_t getUsage() { return current().usage.load(std::memory_order_relaxed); }
+
+            [[nodiscard]] static size_t getPeak() { return current().peak.load(std::memory_order_relaxed); }
+
+            // ʱĴϢޡֵغɵ
+            [[nodiscard]] static std::vector<std::string> getReport();
+
+            static void printInfo(std::ostream &out = std::cout);
+
+        private:
+            static void resetTrigger(size_t usage);
+        };
+
+        // HeapAccount ṹ壺ݵغɼ
+        // غɱ仯 recharge payloadBytes ĵǰֵ HeapQuota ǲʱ˻ȫ
+        struct HeapAccount {
+            explicit HeapAccount(HeapCategory category);
+
+            HeapAccount(const HeapAccount &other);
+
+            HeapAccount &operator=(const HeapAccount &other);
+
+            virtual ~HeapAccount();
+
+        protected:
+            [[nodiscard]] virtual size_t payloadBytes() const = 0;
+
+            void recharge();
+
+        private:
+            HeapQuota::State *quota_; // ݿڰ߳
+            HeapCategory category_;
+            size_t charged_bytes_{0};
+        };
+    }
+
     namespace data {
         struct DType;
         struct Null;
@@ -230,6 +393,8 @@ namespace core {
 
             [[nodiscard]] int getValue() const;
 
+            void setValue(int newValue) noexcept;
+
             [[nodiscard]] id::TypeID &getTypeID() const override;
 
             template<typename Op>
@@ -274,6 +439,8 @@ namespace core {
 
             [[nodiscard]] double getValue() const;
 
+            void setValue(double newValue) noexcept;
+
             [[nodiscard]] id::TypeID &getTypeID() const override;
 
             template<typename Op>
@@ -379,7 +546,7 @@ namespace core {
             virtual bool contains(const std::shared_ptr<RVM_Data> &data) = 0;
         };
 
-        struct String final : Iterable {
+        struct String final : Iterable, memory::HeapAccount {
             static id::TypeID typeId;
 
             explicit String(std::string  value);
@@ -430,11 +597,14 @@ namespace core {
 
             bool contains(const std::shared_ptr<RVM_Data>& data) override;
 
+        protected:
+            [[nodiscard]] size_t payloadBytes() const override;
+
         private:
             std::string value;
         };
 
-        struct List : Iterable {
+        struct List : Iterable, memory::Traceable, memory::HeapAccount {
             static id::TypeID typeId;
 
             explicit List();
@@ -488,11 +658,17 @@ namespace core {
 
             bool contains(const std::shared_ptr<RVM_Data>& data) override;
 
+            void traceChildren(const std::function<void(const base::RVM_Data *)> &visit) const override;
+
+            void clearChildren() override;
+
         protected:
+            [[nodiscard]] size_t payloadBytes() const override;
+
             std::vector<std::shared_ptr<RVM_Data>> dataList{};
         };
 
-        struct Dict final : Iterable {
+        struct Dict final : Iterable, memory::Traceable, memory::HeapAccount {
             static id::TypeID typeId;
 
             explicit Dict();
@@ -554,6 +730,13 @@ namespace core {
 
             std::shared_ptr<List> getValueDataList() const;
 
+            void traceChildren(const std::function<void(const base::RVM_Data *)> &visit) const override;
+
+            void clearChildren() override;
+
+        protected:
+            [[nodiscard]] size_t payloadBytes() const override;
+
         private:
             std::unordered_map<std::string, std::shared_ptr<KeyValuePair>> dataDict{};
             std::vector<std::string> keyList{};
@@ -599,7 +782,7 @@ namespace core {
             [[nodiscard]] std::string getTypeName() const override;
         };
 
-        struct KeyValuePair final : Structure {
+        struct KeyValuePair final : Structure, memory::Traceable {
             static id::TypeID typeId;
 
             explicit KeyValuePair();
@@ -631,6 +814,11 @@ namespace core {
             [[nodiscard]] std::shared_ptr<RVM_Data> getValue() const;
 
             [[nodiscard]] std::string toKVPairString() const;
+
+            void traceChildren(const std::function<void(const base::RVM_Data *)> &visit) const override;
+
+            void clearChildren() override;
+
         private:
             std::shared_ptr<RVM_Data> key = nullptr;
             std::shared_ptr<RVM_Data> value = nullptr;
@@ -669,7 +857,7 @@ namespace core {
          * ֶεֻͨ CustomType ãͨ CustomInst 
          * ʵֶεֻͨ CustomInst ãͨ CustomType 
          */
-        struct CustomType: Structure {
+        struct CustomType: Structure, memory::Traceable {
             static id::TypeID typeId;
             std::string typeName;
             std::shared_ptr<CustomType> parentType;
@@ -720,6 +908,10 @@ namespace core {
             [[nodiscard]] std::string getTypeIDString() const;
 
             [[nodiscard]] std::string getCustomTypeIDString() const;
+
+            void traceChildren(const std::function<void(const base::RVM_Data *)> &visit) const override;
+
+            void clearChildren() override;
         };
 
         /*
@@ -728,7 +920,7 @@ namespace core {
          * ֶκͷ
          * ԻȡʵֶΣҲԻȡֶ
          */
-        struct CustomInst : Structure {
+        struct CustomInst : Structure, memory::Traceable, memory::HeapAccount {
             static id::TypeID typeId;
             std::unordered_map
             <std::string, std::unordered_map
@@ -762,6 +954,13 @@ namespace core {
             [[nodiscard]] std::string getTypeIDString() const;
 
             void derivedToChildType(const std::shared_ptr<CustomType> &childType);
+
+            void traceChildren(const std::function<void(const base::RVM_Data *)> &visit) const override;
+
+            void clearChildren() override;
+
+        protected:
+            [[nodiscard]] size_t payloadBytes() const override;
         };
 
         struct Callable : base::RVM_Data {
@@ -982,8 +1181,6 @@ namespace core {
     }
 
     namespace memory {
-        extern std::unordered_map<std::string, std::shared_ptr<core::data::Extension>> loadedExtensions;
-
         /*
          * RA_Spaceڹռڵݣ
          * ַ֧ͨIDDataIDݵӡҡºɾ
@@ -996,49 +1193,76 @@ namespace core {
 
             RVM_Scope(std::string name, const std::unordered_map<std::string, std::shared_ptr<base::RVM_Data>> &dataMap);
 
-            RVM_Scope(RVM_Scope &&) noexcept = default;
+            ~RVM_Scope();
+
+            // 򰴱ŵǼǣƶŽʧЧ˽ֹƶ
+            RVM_Scope(RVM_Scope &&) = delete;
 
-            RVM_Scope &operator=(RVM_Scope &&) noexcept = default;
+            RVM_Scope &operator=(RVM_Scope &&) = delete;
 
             RVM_Scope(const RVM_Scope &) = delete;
 
             RVM_Scope &operator=(const RVM_Scope &) = delete;
 
+            // Registry ṹ壺ŵǼǱÿһݣ VMContext в̰߳
+            //  0 ʾκ
+            struct Registry {
+                struct Entry {
+                    RVM_Scope *scope = nullptr;
+                    uint32_t next_generation = 0; // ٺ汾ţűʱɴ˼ʹɱʶ
+                };
+
+                std::vector<Entry> entries = std::vector<Entry>(1);
+                std::vector<uint32_t> free_ids;
+            };
+
+            //  DataID еڵǰв򣬱Чʱ nullptr
+            static RVM_Scope *findById(uint32_t scope_id) noexcept;
+
+            [[nodiscard]] uint32_t getId() const noexcept;
+
             [[nodiscard]] const std::string &getName() const noexcept;
 
             void setName(std::string name) noexcept;
 
             void checkOpPermission(const base::OpMode &opMode) const;
 
+            // ΪĽӿȽפΪţٰŷ
             bool contains(const std::string &name) const noexcept;
 
-            void addDataByName(const std::string &name, const std::shared_ptr<base::RVM_Data> &data);
+            bool contains(utils::Symbol symbol) const noexcept;
 
-            void addDataByID(const id::DataID &dataId, const std::shared_ptr<base::RVM_Data> &data);
+            void addDataByName(const std::string &name, const std::shared_ptr<base::RVM_Data> &data);
 
-            std::shared_ptr<base::RVM_Data> findDataByIdString(const std::string &idString) const;
+            // ΪƷλݱʶѴʱ°󶨵ݣɱʶ֮ʧЧ
+            id::DataID addData(utils::Symbol symbol, const std::shared_ptr<base::RVM_Data> &data);
 
             std::shared_ptr<base::RVM_Data> findDataByName(const std::string &name) const;
 
+            std::shared_ptr<base::RVM_Data> findDataByName(utils::Symbol symbol) const;
+
             std::pair<std::optional<id::DataID>, std::shared_ptr<base::RVM_Data>>
             findDataInfoByName(const std::string &name) const;
 
+            std::pair<std::optional<id::DataID>, std::shared_ptr<base::RVM_Data>>
+            findDataInfoByName(utils::Symbol symbol) const;
+
             std::shared_ptr<base::RVM_Data> findDataByID(const id::DataID &varId) const;
 
             bool updateDataByID(const id::DataID &id, const std::shared_ptr<base::RVM_Data>& newData);
 
             bool updateDataByName(const std::string &name, std::shared_ptr<base::RVM_Data> newData) noexcept;
 
+            bool updateDataByName(utils::Symbol symbol, std::shared_ptr<base::RVM_Data> newData) noexcept;
+
             std::optional<id::DataID> getDataIDByName(const std::string &name) const;
 
+            std::optional<id::DataID> getDataIDByName(utils::Symbol symbol) const;
+
             bool removeDataByID(const id::DataID &dataId);
 
             bool removeDataByName(const std::string &name);
 
-            void collectSelf();
-
-            bool thisNeedCollect() const;
-
             void printInfo() const;
 
             size_t size() const noexcept;
@@ -1047,6 +1271,20 @@ namespace core {
 
             void clear() noexcept;
 
+            // ݰ󶨵İ汾ţ滻ƳʱָжϽǷȻЧ
+            [[nodiscard]] size_t getEpoch() const noexcept;
+
+            // ڻջе֡±꣬δʱΪ NO_FRAME
+            [[nodiscard]] size_t getFrameIndex() const noexcept;
+
+            // ļţÿѹջʱжϻĲҽǷԱμ
+            [[nodiscard]] size_t getActivation() const noexcept;
+
+            static constexpr size_t NO_FRAME = static_cast<size_t>(-1);
+
+            // ݵ ID ֵժҪֵ仯ʱժҪ֮仯ϴ󣬽ڵԼ飩
+            [[nodiscard]] size_t fingerprint() const;
+
             base::InstID getInstID() const;
 
             bool isModifiable() const;
@@ -1076,16 +1314,76 @@ namespace core {
             void setRemovable(bool isRemovable);
 
         private:
+            struct Slot {
+                std::shared_ptr<base::RVM_Data> data;
+                utils::Symbol symbol = utils::SymbolTable::NO_SYMBOL; // ղΪ NO_SYMBOL
+                uint32_t generation = 0;
+            };
+
+            // Ʒ -> λĿѰַ̽⣬ɾʱƺԪλĹ
+            struct SlotIndex {
+                static constexpr uint32_t NO_SLOT = static_cast<uint32_t>(-1);
+
+                [[nodiscard]] uint32_t find(utils::Symbol symbol) const noexcept;
+
+                void insert(utils::Symbol symbol, uint32_t slot);
+
+                void erase(utils::Symbol symbol) noexcept;
+
+                void clear() noexcept;
+
+                [[nodiscard]] size_t size() const noexcept { return size_; }
+
+                [[nodiscard]] size_t capacity() const noexcept { return buckets_.size(); }
+
+                // ձԤԪʱݣ 4 ʱ
+                void fit(size_t count);
+
+            private:
+                struct Bucket {
+                    utils::Symbol symbol = utils::SymbolTable::NO_SYMBOL;
+                    uint32_t slot = NO_SLOT;
+                };
+
+                static constexpr size_t INITIAL_CAPACITY = 8; // Ϊ 2 ݣز 3/4
+
+                [[nodiscard]] size_t bucketOf(utils::Symbol symbol) const noexcept;
+
+                void rehash(size_t capacity);
+
+                std::vector<Bucket> buckets_;
+                size_t size_ = 0;
+            };
+
+            // رʶָЧλʶڱʧЧʱ nullptr
+            [[nodiscard]] const Slot *resolveSlot(const id::DataID &dataId) const noexcept;
+
+            void releaseSlot(uint32_t slot);
+
+            [[nodiscard]] id::DataID makeDataID(uint32_t slot) const;
+
+            // ԤĲλظʱԤ
+            void fitCapacity(size_t expected);
+
             base::InstID instID {};
+            Registry *registry_; // ǼڵĵǼǱʱע
+            uint32_t id_;
             std::string name_;
-            bool needCollect = false;
-            std::unordered_map<std::string, std::shared_ptr<base::RVM_Data>> dataMap;
-            std::unordered_map<std::string, id::DataID> nameMap;
+            std::vector<Slot> slots_;
+            std::vector<uint32_t> free_slots_;
+            SlotIndex index_;
+            uint32_t next_generation_ = 0; // ʱã֤ɱʶʧЧ
+            size_t epoch_ = 0;
+            size_t frame_index_ = NO_FRAME;
+            size_t activation_ = 0;
+            size_t *population_hint_ = nullptr; // иƵƣ RVM_Memory ά
             bool addable = true;
             bool updatable = true;
             bool deletable = true;
             bool removable = true;
             bool findable = true;
+
+            friend struct RVM_Memory;
         };
 
         /*
@@ -1113,6 +1411,7 @@ namespace core {
          */
         struct RVM_Memory {
             std::string main_scope_name = MAIN_SCOPE;
+            std::unordered_map<std::string, std::shared_ptr<data::Extension>> loaded_extensions; // ѼصչΪչļ·
 
             RVM_Memory(const RVM_Memory &) = delete;
 
@@ -1127,9 +1426,20 @@ namespace core {
             using DataPair = std::pair<id::DataID, DataPtr>;
 
             static constexpr size_t INITIAL_POOL_SIZE = 10;
+            static constexpr size_t POOL_DECAY_INTERVAL = 256; // ÿͷŸ˥һθˮλü
+
+            struct PoolStats {
+                size_t created{0};
+                size_t reused{0};
+                size_t trimmed{0};
+                size_t peak_active{0};
+            };
             static constexpr const char *DEFAULT_SCOPE_PREFIX = "SCOPE-";
 
-            static RVM_Memory &getInstance();
+            explicit RVM_Memory(size_t initialSize = INITIAL_POOL_SIZE);
+
+            // صǰ̰߳󶨵ڴ棬δʱΪ̼Ĭʵ
+            static RVM_Memory &getInstance() { return base::ThreadBound<RVM_Memory>::current(); }
 
             ScopePtr acquireScope(const std::string &prefix, const std::string &scopeName = "");
 
@@ -1177,6 +1487,8 @@ namespace core {
 
             [[nodiscard]] size_t getFreeScopeCount() const;
 
+            [[nodiscard]] PoolStats getPoolStats() const;
+
             void printPoolInfo();
 
             [[nodiscard]] ScopePtr acquireScopeNoLock(const std::string &name, bool unnamed);
@@ -1199,6 +1511,13 @@ namespace core {
 
             void updateDataByNameNoLock(const std::string& name, DataPtr newData) const;
 
+            void updateDataByNameNoLock(utils::Symbol symbol, DataPtr newData) const;
+
+            //  updateDataByNameNoLock Ĳ˳Ȩ޼飬ؽµݶ󣬲ʱ nullptr
+            [[nodiscard]] DataPtr findUpdateTargetNoLock(const std::string &name) const;
+
+            [[nodiscard]] DataPtr findUpdateTargetNoLock(utils::Symbol symbol) const;
+
             void removeDataNoLock(const id::DataID &varId) const;
 
             void removeDataByNameNoLock(const std::string &name);
@@ -1213,35 +1532,61 @@ namespace core {
 
             [[nodiscard]] DataPair findDataByNameNoLock(const std::string &name) const;
 
-            void start(int intervalMs = 100);
-
-            void stop();
+            [[nodiscard]] DataPair findDataByNameNoLock(utils::Symbol symbol) const;
 
             void setCurrentScopeByName(const std::string &scope_name);
 
             const ScopePtr &getGlobalScope() const;
 
-        private:
-            explicit RVM_Memory(size_t initialSize = INITIAL_POOL_SIZE);
+            // ȫ뵱ǰл
+            [[nodiscard]] std::vector<ScopePtr> getVisibleScopesNoLock() const;
 
-            void collectGarbage();
-
-            std::queue<ScopePtr> freeScopes_;
-            std::list<ScopePtr> activeScopes_;
-            mutable std::unordered_map<std::string, std::pair<id::DataID, std::weak_ptr<base::RVM_Data>>> recentAccessCache_;
+        private:
+            // ˥ˮλüˮλ֮ INITIAL_POOL_SIZE
+            void trimPoolNoLock();
+
+            // ѹջ¼֡±
+            void pushScopeFrameNoLock(const ScopePtr &scope);
+
+            // Ƴջջֱӵλãչƶ֡±
+            void popScopeFrameNoLock(const ScopePtr &scope);
+
+            struct AccessCacheEntry {
+                id::DataID id;
+                std::weak_ptr<base::RVM_Data> data;
+                const RVM_Scope *scope; // ڵ
+                size_t activation;      // ʱļ
+            };
+
+            // ԴͬһμδʧЧʱݣ򷵻 nullptr
+            static DataPtr getValidCacheData(const AccessCacheEntry &entry);
+
+            // صǰ¸÷ŵЧݣδʱ nullptr
+            [[nodiscard]] DataPtr findCachedDataNoLock(utils::Symbol symbol) const;
+
+            static const utils::Symbol DISCARD_SYMBOL; // Ŀ "_" ķ
+
+            std::vector<ScopePtr> freeScopes_; // 򣬺ȳͷΪδʹõ
+            size_t watermark_ = 0; // ĸˮλͷŴ˥ǰ
+            size_t releases_since_decay_ = 0;
+            PoolStats poolStats_;
+            //  -> ͷʱƣȡʱݴԤ
+            std::unordered_map<std::string, size_t> populationHints_;
+            std::vector<ScopePtr> activeScopes_; // ջ±꼴֡±
+            // ǰ -> Ʒ -> ҽƳջʱֻ趪ΪǰĻ
+            mutable std::unordered_map<const RVM_Scope *, std::unordered_map<utils::Symbol, AccessCacheEntry>> recentAccessCache_;
             mutable std::mutex mutex_;
             std::unordered_map<std::string, std::weak_ptr<RVM_Scope>> namedScopes_;
             std::size_t nextDefaultNameId_;
-            bool running_;
             bool hasInitialized_ {false};
             mutable ScopePtr globalScope_ = std::make_shared<RVM_Scope>(GLOBAL_SCOPE);
             ScopePtr currentScope_ = nullptr;
 
             RVM_Memory::ScopePtr
-            findOperableScopeByDataName(const std::string &name, bool needContains, const base::OpMode &opMode) const;
+            findOperableScopeByDataName(utils::Symbol symbol, bool needContains, const base::OpMode &opMode) const;
         };
 
-        extern RVM_Memory &data_space_pool;
+        inline RVM_Memory &data_space_pool() { return RVM_Memory::getInstance(); }
     }
 
     namespace data {
@@ -16,14 +16,14 @@ namespace parser {
 
     struct InsSetPool;
 
-    extern core::memory::RVM_Memory &data_space_pool;
-    extern base::RVM_IO* io;
-    extern InsSetPool &ins_set_pool;
+    using core::memory::data_space_pool;
     extern utils::StringManager &string_manager;
     using StdInsSet = std::shared_ptr<InsSet>;
 
     struct InsSetPool {
     public:
+        InsSetPool() = default;
+
         static InsSetPool& getInstance();
 
         InsSetPool (const InsSetPool&) = delete;
@@ -44,13 +44,16 @@ namespace parser {
         void printInfo(std::ostream& out = std::cout) const;
 
     private:
-        InsSetPool() = default;
-
         std::unordered_map<std::string, StdInsSet> insSetSpace_;
         std::list<StdInsSet> insSetOrder_;
         std::vector<StdInsSet> insSetPool_;
     };
 
+    // 当前线程绑定的虚拟机的输出与指令集池，未绑定时为进程级的默认实例
+    inline base::RVM_IO *io() { return base::RVM_IO::getInstance(); }
+
+    inline InsSetPool &ins_set_pool() { return InsSetPool::getInstance(); }
+
     namespace components {
         extern StdInsSet INS_SET;
     }
@@ -64,6 +67,10 @@ namespace parser {
 
         extern std::string precompiled_link_dir_path;
 
+        extern int rasm_cache_capacity;
+
+        extern bool compile_cache_option;
+
         void initialize(const std::string &executed_file_path, const std::string &working_directory);
 
         void addIns(const utils::Pos &pos, const std::string& raw_code, const RI *ri, const StdArgs &args);
@@ -91,12 +98,145 @@ namespace parser {
         std::shared_ptr<InsSet> parseCodeFromPath(const std::string &code_file_path, bool output_info,
                                                   const std::string &extension_name = "");
 
+        void serializeExecutableIns(std::ostream &out, const std::shared_ptr<InsSet> &ins_set,
+                                    const utils::SerializationProfile &profile);
+
         void serializeExecutableInsToBinaryFile(std::string binary_file_path, const std::shared_ptr<InsSet> &ins_set, const utils::SerializationProfile &profile);
 
+        std::shared_ptr<InsSet> deserializeExecutableIns(std::istream &in, const std::string &binary_file_path,
+                                                         const utils::SerializationProfile &profile);
+
         std::shared_ptr<InsSet> deserializeExecutableInsFromBinaryFile(std::string binary_file_path,
                                                                        const utils::SerializationProfile &profile = utils::SerializationProfile::Debug);
 
         std::shared_ptr<InsSet> getLinkedInsSet(const Ins &link_ins, bool check_exist = true, const std::string &path = "");
+
+        // CompileCache 结构体：运行 RA 文件时的磁盘编译缓存
+        // 缓存文件位于源文件同级的 __rvmcache__ 目录，记录源文件及其 LINK 闭包中各文件的路径、修改时间、大小与内容哈希，
+        // 全部未变化时直接反序列化指令集，跳过预处理与解析
+        struct CompileCache {
+        public:
+            static constexpr const char *CACHE_DIR_NAME = "__rvmcache__";
+            static constexpr size_t MAX_PATH_LENGTH = 4096; // 读取缓存时路径长度的上限，超出视为缓存损坏
+
+            // 返回源文件的可执行指令集，缓存失效时重新解析并写回缓存
+            static std::shared_ptr<InsSet> load(const std::string &code_file_path);
+
+            // 删除源文件所在目录的缓存目录，返回是否删除了缓存
+            static bool clear(const std::string &code_file_path);
+
+            // 解析期间记录被 LINK 的文件，构成缓存的依赖闭包
+            static void recordDependency(const std::string &file_path);
+
+            // 当前线程已记录的依赖数量，用于判断一次解析期间是否发生了 LINK
+            static size_t recordedDependencyCount() { return recorded_paths_.size(); }
+
+        private:
+            struct Dependency {
+                std::string path;
+                long long mtime{0};
+                uintmax_t size{0};
+                size_t hash{0};
+
+                static Dependency of(const std::string &file_path);
+
+                [[nodiscard]] bool isUpToDate() const;
+            };
+
+            static std::string getCachePath(const std::string &code_file_path);
+
+            // 缓存指纹：RSI 格式（版本与指令表）及影响解析结果的运行选项（调试模式）
+            static size_t getFingerprint();
+
+            static std::shared_ptr<InsSet> read(const std::string &cache_path, const std::string &code_file_path);
+
+            static void write(const std::string &cache_path, const std::shared_ptr<InsSet> &ins_set,
+                              const std::vector<Dependency> &dependencies);
+
+            static thread_local std::vector<std::string> recorded_paths_; // 各线程上的解析互不干扰
+        };
+
+        // RasmCache 结构体：EXE_RASM 动态代码的解析缓存
+        // 以源码与调用位置的哈希为键，容量由 env::rasm_cache_capacity 限定，超出时淘汰最近最少使用的条目
+        struct RasmCache {
+        public:
+            struct Stats {
+                size_t hits{0};
+                size_t misses{0};
+                size_t evictions{0};
+            };
+
+            RasmCache() = default;
+
+            static RasmCache &getInstance();
+
+            RasmCache(const RasmCache &) = delete;
+            RasmCache &operator=(const RasmCache &) = delete;
+
+            // 返回源码对应的可执行指令集，未命中时解析并缓存
+            std::shared_ptr<InsSet> acquire(const std::string &code_path, const std::string &code,
+                                            const utils::Pos &pos);
+
+            void clear();
+
+            [[nodiscard]] const Stats &getStats() const { return stats_; }
+
+            void printInfo(std::ostream &out = std::cout) const;
+
+        private:
+            struct Entry {
+                size_t key;
+                std::string code;
+                std::string pos;
+                std::shared_ptr<InsSet> ins_set;
+            };
+
+            std::list<Entry> entries_{}; // 按最近使用排序，表头为最近使用
+            std::unordered_map<size_t, std::list<Entry>::iterator> index_{};
+            Stats stats_{};
+        };
+
+        // ExtensionCache 结构体：LOADIN 扩展文件的进程级解析缓存
+        // 以规范化后的扩展路径及是否绑定扩展作用域为键，记录文件的修改时间与大小，二者均未变化时视为命中。
+        // 指令集携带执行状态且各虚拟机的作用域互不相同，不能在扩展实例间共享，
+        // 因此缓存保存解析结果的序列化字节，每次加载反序列化出独立的指令集。
+        // 含 LINK 的扩展其解析结果依赖当前虚拟机已加载的文件，不予缓存
+        struct ExtensionCache {
+        public:
+            struct Stats {
+                size_t hits{0};
+                size_t misses{0};
+            };
+
+            static ExtensionCache &getInstance();
+
+            ExtensionCache(const ExtensionCache &) = delete;
+            ExtensionCache &operator=(const ExtensionCache &) = delete;
+
+            // 返回扩展文件的一份独立的可执行指令集，scoped 为 false 时指令不绑定扩展作用域（无标识符加载）
+            std::shared_ptr<InsSet> acquire(const std::string &extension_path, bool scoped);
+
+            void clear();
+
+            [[nodiscard]] Stats getStats() const;
+
+            void printInfo(std::ostream &out = std::cout) const;
+
+        private:
+            ExtensionCache() = default;
+
+            struct Entry {
+                long long mtime{0};
+                uintmax_t size{0};
+                bool verified{false};
+                std::shared_ptr<const std::string> bytes; // 以调试配置序列化的指令集
+            };
+
+            std::unordered_map<std::string, Entry> scoped_entries_{};
+            std::unordered_map<std::string, Entry> unscoped_entries_{};
+            Stats stats_{};
+            mutable std::mutex mutex_;
+        };
     }
 
 }
@@ -0,0 +1,64 @@
+//
+// Created by RestRegular on 2026/10/19.
+//
+
+#ifndef RVM_RVM_CONTEXT_H
+#define RVM_RVM_CONTEXT_H
+
+#include <memory>
+#include <tuple>
+#include "ra_base.h"
+#include "ra_core.h"
+#include "rvm_ris.h"
+#include "ra_parser.h"
+
+namespace parser {
+    // VMContext 结构体：一个独立虚拟机的全部运行状态
+    // 输出、工作目录栈、作用域登记表、环回收器、堆配额、内存、执行状态与解析缓存均由上下文持有，
+    // 在线程上绑定后，执行函数经各状态的 current() 访问该线程上运行的虚拟机；
+    // 同一进程中可创建多个上下文并分别在不同线程上运行。指令集与数据不可在上下文之间共享，且应先于所属上下文释放
+    struct VMContext {
+        // Binding 结构体：在当前线程上绑定上下文，析构时恢复之前的绑定
+        struct Binding {
+            explicit Binding(VMContext &context);
+
+            ~Binding();
+
+            Binding(const Binding &) = delete;
+
+            Binding &operator=(const Binding &) = delete;
+
+        private:
+            using States = std::tuple<base::RVM_IO *, base::WorkingDirectories *,
+                    core::memory::CycleCollector::State *, core::memory::HeapQuota::State *,
+                    core::memory::RVM_Scope::Registry *, core::memory::RVM_Memory *,
+                    ExecutionState *, InsSetPool *, parse::RasmCache *>;
+
+            static States bind(const States &states);
+
+            States previous_;
+        };
+
+        VMContext();
+
+        ~VMContext();
+
+        VMContext(const VMContext &) = delete;
+
+        VMContext &operator=(const VMContext &) = delete;
+
+    private:
+        // 声明顺序即构造顺序：记账与登记在前，持有数据的成员在后，析构时数据先于记账与登记释放
+        base::RVM_IO io_;
+        base::WorkingDirectories working_directories_;
+        core::memory::CycleCollector::State collector_;
+        core::memory::HeapQuota::State quota_;
+        core::memory::RVM_Scope::Registry scope_registry_;
+        std::unique_ptr<core::memory::RVM_Memory> memory_; // 绑定本上下文后构造，使其作用域登记到本上下文
+        ExecutionState execution_;
+        InsSetPool ins_set_pool_;
+        parse::RasmCache rasm_cache_;
+    };
+}
+
+#endif //RVM_RVM_CONTEXT_H
@@ -5,16 +5,21 @@
 #ifndef RVM_RVM_RIS_H
 #define RVM_RVM_RIS_H
 
+#include <array>
+#include <chrono>
+#include <deque>
+#include <list>
+#include <memory_resource>
+#include <optional>
+#include <set>
+#include <string_view>
+#include <variant>
 #include <vector>
 #include "ra_core.h"
 
 namespace core::components {
     // ȫֱ
-    extern std::unordered_map<int, const RI*> insMap;
-    extern std::unordered_map<std::string, const RI*> insNameMap;
     extern std::vector<RI *> ri_list;
-    extern id::DataID SR_SpaceID;
-    extern id::DataID _SE_SpaceID;
 
     // öִࣺ״̬
     enum class ExecutionStatus {
@@ -44,28 +49,35 @@ namespace core::components {
     };
 
     // RIࣺRVM Instructionָ
+    // ָΪʼľ̬󣬲ھ̬ʼڼţַе
     struct RI {
-        RIID id = RIID();
-        std::string name{};
+        std::string_view name{};
         int arity{};
         ExecutorFunc executor{};
         bool hasScope{false};
         bool isDelayedReleaseScope{false}; // Ƿӳͷscope
+        ExecutorFunc uncheckedExecutor{}; // ִкָ̬ͨУʹãΪ
 
-        RI() = default;
+        constexpr RI() = default;
 
-        RI(std::string name,
-            int arity,
-            ExecutorFunc executor,
-            bool isCreatedScope = false,
-            bool isDelayedReleaseScope = false);
+        constexpr RI(const std::string_view name,
+                     const int arity,
+                     const ExecutorFunc executor,
+                     const bool isCreatedScope = false,
+                     const bool isDelayedReleaseScope = false,
+                     const ExecutorFunc uncheckedExecutor = nullptr)
+                : name(name), arity(arity), executor(executor), hasScope(isCreatedScope),
+                  isDelayedReleaseScope(isDelayedReleaseScope), uncheckedExecutor(uncheckedExecutor) {}
 
-        bool operator==(const RI &other) const;
+        bool operator==(const RI &other) const { return this == &other; }
 
-        bool equalWith(const RI* other) const;
+        bool equalWith(const RI* other) const { return this == other; }
 
         std::string toString() const;
 
+        // ָָе±꣬ʽݱͬ
+        std::string getIDString() const;
+
         void serialize(std::ostream &os, const utils::SerializationProfile &profile) const;
 
         static const RI* deserialize(std::istream& is, const utils::SerializationProfile& profile);
@@ -73,23 +85,296 @@ namespace core::components {
         static const RI* getRIByStr(const std::string& content);
     };
 
+    // TypeFeedback ṹ壺ָͷ¼Ĺ۲Ŀֲִ꣬ػȵָ
+    struct TypeFeedback {
+        enum class State : uint8_t {
+            Uninitialized, // δ۲
+            Monomorphic,   // ̬ʼչ۲⵽ͬһͣĿ꣩
+            Polymorphic    // ̬۲⵽ͣĿ꣩
+        };
+
+        static constexpr size_t MAX_OPERANDS = 2;
+        static constexpr uint8_t MAX_DEOPT_COUNT = 4; // ȥŻﵽ޺ػָ
+
+        const base::RVM_Data *call_target{nullptr}; // ڱȽݣ
+        std::array<base::IDType, MAX_OPERANDS> operand_types{};
+        std::array<State, MAX_OPERANDS> operand_states{};
+        State call_target_state{State::Uninitialized};
+        uint8_t deopt_count{0};
+
+        void recordOperand(const size_t &index, const base::IDType &type);
+
+        void recordCallTarget(const base::RVM_Data *target);
+
+        [[nodiscard]] bool isMonomorphic(const size_t &index, const base::IDType &type) const;
+
+        // չ۲¼ȥŻ
+        void reset();
+    };
+
+    // ExtFieldCache ṹ壺EXT_GET ָ
+    //  InsSet::verify ԤȡֶLOADIN չ󶨵ָøչʶ EXT_GET
+    // ִʱչָ󶨵չͬݰ汾δ仯ʱֱӸϴνĽ
+    struct ExtFieldCache {
+        std::shared_ptr<data::Extension> extension{}; // 󶨵չѼصչݿռس
+        size_t epoch{0};
+        std::string field{};
+        bool literal_field{false}; // ֶΪִַʱٽ
+        std::weak_ptr<base::RVM_Data> data{}; // ݣӰĻ
+
+        static std::shared_ptr<ExtFieldCache> build(const Ins &ext_get_ins);
+
+        // չ󶨵ָ ident չ EXT_GET ָ
+        static void bind(const InsSet &ins_set, utils::Symbol ident,
+                         const std::shared_ptr<data::Extension> &extension);
+    };
+
+    // FusedCompare ṹ壺CMPJ ָԤ
+    // ϵ־״ִʱһΣʶÿִʱֱӶȡɱȽ
+    struct FusedCompare {
+        base::Relational relation{};
+        std::array<std::shared_ptr<base::RVM_Data>, 2> constants{}; // ʶӦ nullptr
+
+        static std::shared_ptr<FusedCompare> build(const Ins &cmpj_ins);
+    };
+
+    // ConstantContainer ṹ壺LIST_LIT / DICT_LIT ָĳغ
+    // Ԫֵ״ִʱһΣÿִֻԪִ׷ָ
+    struct ConstantContainer {
+        std::vector<std::shared_ptr<base::RVM_Data>> items{}; // бԪأֵ䰴ֵ
+        std::vector<std::string> keys{}; // ֵתֵַ˳һ
+
+        [[nodiscard]] std::shared_ptr<base::RVM_Data> instantiate(bool is_dict) const;
+
+        static std::shared_ptr<ConstantContainer> build(const Ins &literal_ins, bool is_dict);
+    };
+
+    // MemoTable ṹ壺 MEMO ָΪĽ
+    // ԲֵĽṹݣʱ̭ʹõĿ
+    struct MemoTable {
+        struct Stats {
+            size_t hits{0};
+            size_t misses{0};
+            size_t evictions{0};
+        };
+
+        static constexpr size_t DEFAULT_CAPACITY = 256;
+
+        MemoTable(std::string func_name, size_t capacity);
+
+        // 沢ǼǣԱͳһͳϢ
+        static std::shared_ptr<MemoTable> create(const std::string &func_name, size_t capacity);
+
+        // ɲֵ컺ͣIntFloatCharBoolStringNull뻺棬
+        // кʵʱ std::nullopt
+        static std::optional<std::string> makeKey(const std::vector<std::shared_ptr<base::RVM_Data>> &args,
+                                                  size_t arg_count);
+
+        [[nodiscard]] std::shared_ptr<base::RVM_Data> find(const std::string &key);
+
+        void store(const std::string &key, std::shared_ptr<base::RVM_Data> value);
+
+        void setCapacity(size_t capacity);
+
+        void clear();
+
+        [[nodiscard]] const Stats &getStats() const { return stats_; }
+
+        // дͳϢڻʱ
+        static void printInfo(std::ostream &out);
+
+    private:
+        struct Entry {
+            std::string key;
+            std::shared_ptr<base::RVM_Data> value;
+        };
+
+        std::string func_name_;
+        size_t capacity_;
+        std::list<Entry> entries_{}; // ʹ򣬱ͷΪʹ
+        std::unordered_map<std::string, std::list<Entry>::iterator> index_{};
+        Stats stats_{};
+
+        static thread_local std::vector<std::weak_ptr<MemoTable>> registry_;
+    };
+
+    // SourceMap ࣺԴӳļָӦԴУָֻ¼ļк
+    // ڸʽϢʱѯӳеԴĳڴ
+    class SourceMap {
+    public:
+        // File ṹ壺һļԴ룬βӴͬһʼƫȡ
+        struct File {
+            std::pmr::string text;
+            std::pmr::vector<uint32_t> line_offsets;
+
+            // Ĺ캯ʹӳͬһڴԴйļ
+            using allocator_type = std::pmr::polymorphic_allocator<>;
+
+            explicit File(const allocator_type &allocator) : text(allocator), line_offsets(allocator) {}
+
+            [[nodiscard]] std::string_view line(uint32_t index) const;
+        };
+
+        explicit SourceMap(std::pmr::memory_resource *resource) : files_(resource) {}
+
+        // Դ׷ӵļļк
+        std::pair<const File *, uint32_t> addLine(const std::string *filepath, std::string_view code);
+
+    private:
+        std::pmr::unordered_map<const std::string *, File> files_; // פļ·Ϊڵ㲻ƶָеָ뱣Ч
+    };
+
+    // ProgramArena ࣺһνлõָԴıõĵڴ
+    // ڽڵ㲻黹ڴ俪ڼ䴴ָУһָͷʱڴһͷ
+    class ProgramArena {
+    public:
+        // ֻ¼ڴӳڣڵָֻɳиڴָ
+        template<typename T>
+        struct Allocator {
+            using value_type = T;
+
+            ProgramArena *arena;
+
+            explicit Allocator(ProgramArena *arena) : arena(arena) {}
+
+            template<typename U>
+            Allocator(const Allocator<U> &other) : arena(other.arena) {}
+
+            T *allocate(const size_t n) {
+                return static_cast<T *>(arena->resource_.allocate(n * sizeof(T), alignof(T)));
+            }
+
+            void deallocate(T *, size_t) noexcept {}
+
+            template<typename U>
+            bool operator==(const Allocator<U> &other) const { return arena == other.arena; }
+        };
+
+        // ڵǰ߳Ͽڴʱָ֮ǰڴıڴһͬ
+        class Scope {
+        public:
+            // µڴ
+            explicit Scope(size_t initial_size);
+            // ¿еڴָ׷ָ
+            explicit Scope(std::shared_ptr<ProgramArena> arena);
+            ~Scope();
+            Scope(const Scope &) = delete;
+            Scope &operator=(const Scope &) = delete;
+        private:
+            std::shared_ptr<ProgramArena> previous_;
+            utils::ArgTextTable::Scope arg_text_scope_;
+        };
+
+        static constexpr size_t DEFAULT_INITIAL_SIZE = 1024; // ָ贴ڴʱ׿ĴС
+
+        explicit ProgramArena(const size_t initial_size)
+                : resource_(initial_size), source_map_(&resource_), arg_texts_(&resource_) {}
+
+        // ǰ߳̿ڴδʱΪ nullptr
+        static const std::shared_ptr<ProgramArena> &current() { return current_; }
+
+        // ǰڴڴԴָĲбʹãδڴʱΪĬԴ
+        static std::pmr::memory_resource *resource() {
+            return current_ ? &current_->resource_ : std::pmr::get_default_resource();
+        }
+
+        // Դд뵱ǰڴԴӳڴеָͬڣδڴʱ׳쳣
+        static std::pair<const SourceMap::File *, uint32_t> addSourceLine(const std::string *filepath,
+                                                                        std::string_view code);
+
+        // ֻ黹ڴɾڵзڴеĶ
+        struct Destroy {
+            template<typename T>
+            void operator()(T *object) const { std::destroy_at(object); }
+        };
+
+        // ڵǰ߳̿ڴйɷصָ뵥Уδڴʱ׳쳣
+        template<typename T, typename... Args>
+        static std::unique_ptr<T, Destroy> makeOwned(Args &&... args) {
+            if (!current_) {
+                throw std::logic_error("Program nodes can only be created while an arena is open.");
+            }
+            return std::unique_ptr<T, Destroy>(
+                    std::pmr::polymorphic_allocator<T>(&current_->resource_).template new_object<T>(
+                            std::forward<Args>(args)...));
+        }
+
+        // ڵǰ߳̿ڴзڵ㣻δڴʱ׳쳣
+        template<typename T, typename... Args>
+        static std::shared_ptr<T> make(Args &&... args) {
+            if (!current_) {
+                throw std::logic_error("Program nodes can only be created while an arena is open.");
+            }
+            return std::allocate_shared<T>(Allocator<T>(current_.get()), std::forward<Args>(args)...);
+        }
+
+    private:
+        std::pmr::monotonic_buffer_resource resource_;
+        SourceMap source_map_;
+        utils::ArgTextTable arg_texts_;
+
+        static thread_local std::shared_ptr<ProgramArena> current_;
+    };
+
+    // InsSideRecord ṹ壺ָʹõݣָƳֻΪõָڴз
+    // ָʹ scopeInsSetADD / MUL / CALL / IVOK ʹ feedbackATMP / EXT_GET / CMPJ / LIST_LIT / DICT_LIT ʹ side_data
+    struct InsSideRecord {
+        std::shared_ptr<InsSet> scopeInsSet; // Ҫл
+        TypeFeedback feedback{}; // лִкʱ¼
+        // лָרĸݣATMP ָĲֽ EXT_GET Ļ InsSet::verify ɣ
+        // CMPJ / LIST_LIT / DICT_LIT Ļ״ִʱ
+        std::variant<std::monostate, std::shared_ptr<AtmpLayout>, std::shared_ptr<ExtFieldCache>,
+                std::shared_ptr<FusedCompare>, std::shared_ptr<ConstantContainer>> side_data;
+
+        // òָǷҪӼ¼
+        static bool isUsedBy(const RI *ri);
+    };
+
     // InsࣺRAĿִָ
     struct Ins {
         utils::Pos pos{}; // Posлͷл
         const RI *ri; // RIл;̬л
         InsID insId = core::id::InsID(); // л
         StdArgs args; // utils::Argлͷлעvectorл
-        std::shared_ptr<InsSet> scopeInsSet;
-        std::string raw_code;
+        // Ӽ¼ҪݵָΪ nullptrִкָֻ ATMP ָֺԭָ
+        // ֱָָ¼ָڱв
+        std::unique_ptr<InsSideRecord, ProgramArena::Destroy> side_record;
+        const SourceMap::File *source_file{nullptr}; // ҪлԴӳеļ source_line һͨ rawCode 
+        mutable ExecutorFunc executor{}; // лʵʵõִк InsSet::verify 󶨣ֲִʱɱ滻
+        int label_pointer{-1}; // лתָĿλã InsSet::verify 
+        utils::Symbol ext{utils::SymbolTable::NO_SYMBOL}; // Ҫлչפţͨ extName 
         bool is_delayed_release_scope{false}; // Ҫл
-        std::string ext; // ToDo: Ҫл
+        uint32_t source_line{0}; // Դ source_file екţĩβռö
 
-        Ins() = default;
+        Ins() : args(ProgramArena::resource()) {}
 
         Ins(utils::Pos pos, std::string raw_code, const RI *ri, StdArgs args, std::string ext);
 
         ExecutionStatus execute(size_t &pointer) const;
 
+        [[nodiscard]] std::string rawCode() const;
+
+        [[nodiscard]] const std::string &extName() const;
+
+        // ָָָΪ nullptr
+        [[nodiscard]] const std::shared_ptr<InsSet> &scopeInsSet() const {
+            static const std::shared_ptr<InsSet> no_scope;
+            return side_record ? side_record->scopeInsSet : no_scope;
+        }
+
+        // ͷ InsSideRecord::isUsedBy гļ¼ָɵ
+        [[nodiscard]] TypeFeedback &feedback() const { return side_record->feedback; }
+
+        // ȡָĸݣδʱΪ nullptrÿָֻʹһ
+        template<typename T>
+        std::shared_ptr<T> &cached() const {
+            auto &side_data = side_record->side_data;
+            if (auto *data = std::get_if<std::shared_ptr<T>>(&side_data)) {
+                return *data;
+            }
+            return side_data.template emplace<std::shared_ptr<T>>();
+        }
+
         void addIns(std::shared_ptr<Ins> ins) const;
 
         void serialize(std::ostream &os, const utils::SerializationProfile &profile) const;
@@ -101,7 +386,6 @@ namespace core::components {
     struct DetectBlock {
         std::shared_ptr<data::CustomType> detected_type = nullptr;
         utils::Arg error_stored_arg;
-        std::shared_ptr<data::CustomInst> error_data = nullptr;
         std::shared_ptr<InsSet> block_ins_set;
 
         DetectBlock(std::shared_ptr<data::CustomType> detected_type,
@@ -109,19 +393,57 @@ namespace core::components {
                     std::shared_ptr<InsSet> block_ins_set);
     };
 
+    // AtmpBlock ṹ壺ATMP ִе״ֵ̬ѹ atmp_stack
     struct AtmpBlock {
-        std::vector<std::shared_ptr<DetectBlock>> detect_blocks{};
-        std::shared_ptr<InsSet> block_ins_set = nullptr;
-        std::shared_ptr<InsSet> finally_block_ins_set = nullptr;
+        const AtmpLayout *layout = nullptr;
 
         // еdetect
-        std::shared_ptr<DetectBlock> hit_detect_block = nullptr;
+        const DetectBlock *hit_detect_block = nullptr;
+        std::shared_ptr<data::CustomInst> error_data = nullptr;
+    };
 
-        bool is_hit{false};
+    // AtmpLayout ṹ壺ATMP ֺĽṹ
+    // ׸ DETECT ֮ǰָɳԿ飬ķ DETECT ָ FINALLY 飬
+    //  DETECT ָԭеָͬһ ATMP ִָʱ²
+    struct AtmpLayout {
+        std::shared_ptr<InsSet> attempt_ins_set = nullptr;
+        std::vector<std::shared_ptr<Ins>> detect_ins_list{};
+        std::shared_ptr<InsSet> finally_ins_set = nullptr;
+        // ״ִʱƽ˺ֱִӸ
+        std::vector<DetectBlock> detect_blocks{};
+        bool detect_resolved{false};
 
-        AtmpBlock(std::vector<std::shared_ptr<DetectBlock>> detectBlocks,
-                  std::shared_ptr<InsSet> block_ins_set,
-                  std::shared_ptr<InsSet> finally_block_ins_set);
+        static std::shared_ptr<AtmpLayout> split(const Ins &atmp_ins);
+
+        void resolveDetectTypes(const Ins &atmp_ins);
+    };
+
+    // ExecutionBudget ṹ壺ָȼЭʽȫ
+    // ָѭãתΪȫ㣬ÿһһλȼϣ
+    // ȼϰεþʱżȼʱޣSIGINT λжϱ־ÿȫ
+    // ÿ ExecutionState УĻӰ
+    struct ExecutionBudget {
+        static constexpr int CHECK_INTERVAL = 1024;
+        int fuel_limit{0}; // ȼޣ 0 ʱ
+        int time_limit_ms{0}; // ʱޣ룩 0 ʱ
+
+        void start();
+
+        void safepoint() {
+            if (--countdown_ <= 0 || base::PROGRAM_INTERRUPTED || memory::HeapQuota::underPressure()) [[unlikely]] {
+                check();
+            }
+        }
+
+        [[nodiscard]] long long getConsumedFuel() const { return consumed_ + (batch_ - countdown_); }
+
+    private:
+        void check();
+
+        int countdown_ = CHECK_INTERVAL;
+        int batch_ = CHECK_INTERVAL;
+        long long consumed_ = 0;
+        std::chrono::steady_clock::time_point deadline_{};
     };
 
     enum class DebugMode {
@@ -131,9 +453,75 @@ namespace core::components {
         FastSkip // ޱעָ
     };
 
+    // BreakpointTable ṹ壺Զϵ㣬ÿ ExecutionState 
+    // ϵ㰴ļкż¼λõִָк滻Ϊ庯ִѭвϵ㣻
+    // ԭִкָ±꣩¼ָͷʱһƳ
+    // ϵ仯ʱ汾ţָڽʱȽϰ汾Ų´򲹶ϵָ
+    struct BreakpointTable {
+        bool add(const std::string *filepath, int line);
+
+        bool remove(const std::string *filepath, int line);
+
+        // ǰϵΪָеָ򲹶ָԭִк
+        void patch(InsSet &ins_set);
+
+        void patchActiveInsSets();
+
+        // Ƴָָԭִк¼ָʱ
+        void forget(const InsSet *ins_set);
+
+        // 庯Խٵԭִк
+        static ExecutionStatus trap(const Ins &ins, size_t &pointer, const StdArgs &args);
+
+        [[nodiscard]] size_t getEpoch() const { return epoch_; }
+
+    private:
+        using Location = std::pair<const InsSet *, size_t>;
+
+        struct LocationHash {
+            size_t operator()(const Location &location) const noexcept {
+                return std::hash<const InsSet *>{}(location.first) ^ (location.second * 0x9e3779b97f4a7c15ULL);
+            }
+        };
+
+        size_t epoch_{0};
+        std::set<std::pair<const std::string *, int>> lines_{}; // ļ·ΪפַַȽ
+        std::unordered_map<Location, ExecutorFunc, LocationHash> original_executors_{};
+    };
+
+    // ExecutionState ṹ壺һִ״̬
+    //  VMContext в̰߳󶨣ִкͨ current() ʵǰ߳е
+    struct ExecutionState {
+        DebugMode debug_mode{DebugMode::None}; // л
+        std::string file_record; // л
+        std::stack<InsSet *> exe_stack; // л
+        std::vector<AtmpBlock> atmp_stack; // л
+        std::vector<std::shared_ptr<base::RVM_Data>> return_registers; // лÿ㺯һֵĴ
+        id::DataID sr_space_id{}; // ȫ SR ıʶ
+        id::DataID se_space_id{}; // ȫ _SE ıʶ
+        // SR Ϊݱ¼Ƿ RET ں֮дݣIVOK ֻڴʱ
+        bool sr_holds_return_value{false};
+        BreakpointTable breakpoints; // л
+        ExecutionBudget budget; // л
+        bool memo_purity_check{false}; // Ϊ true ʱ鴿Ƿ޸֮
+        bool initialized{false}; // лѳʼٴγʼʱڴ
+
+        [[nodiscard]] static ExecutionState &current() { return base::ThreadBound<ExecutionState>::current(); }
+
+        // ǰִеָִջΪաָδѹָָָԽʱΪ nullptr
+        [[nodiscard]] const Ins *currentIns() const;
+    };
+
     // InsSet ṹ壺ִָ
     struct InsSet {
-        explicit InsSet(std::string prefix) : scope_prefix(std::move(prefix)) {}
+        // ڴڼ䴴ָиڴ
+        explicit InsSet(std::string prefix) : scope_prefix(std::move(prefix)) {
+            if (const auto &arena = ProgramArena::current()) {
+                arenas_.push_back(arena);
+            }
+        }
+
+        ~InsSet();
 
         [[nodiscard]] const base::InstID &getInstID() const { return instId; }
 
@@ -141,12 +529,20 @@ namespace core::components {
 
         void insertInsSet(const std::shared_ptr<InsSet>& insSet_);
 
+        // һָָͬڵڴָָ
+        void shareArenasWith(const InsSet &other);
+
+        // ָе׸ڴδʱ½һڽָ֮׷ָ
+        const std::shared_ptr<ProgramArena> &arena();
+
         [[nodiscard]] const std::vector<std::shared_ptr<Ins>> &getInsSet() const { return insSet; }
 
         void setLabel(const std::string &label, const int set_pointer) const { set_labels[label] = set_pointer; }
 
         [[nodiscard]] int getLabel(const std::string &label) const;
 
+        [[nodiscard]] const std::unordered_map<std::string, int> &getLabels() const { return set_labels; }
+
         void setScopeLeader(const std::string &leader) { scope_leader = leader; }
 
         void setScopeLeader(const Ins &leaderIns);
@@ -166,7 +562,10 @@ namespace core::components {
                 const std::string &ins_set_raw_code, const std::string &scope_leader_pos_,
                 const std::string &scope_leader_);
 
-        static std::shared_ptr<memory::RVM_Scope> loadinExtension(const std::string &ext_name);
+        // չ״νʱչ󶨵ָֻ֮жϸǷѴڻ״̬
+        std::shared_ptr<memory::RVM_Scope> loadinExtension();
+
+        static std::shared_ptr<memory::RVM_Scope> resolveExtensionScope(const std::string &ext_name);
 
         static void unloadExtension(const std::shared_ptr<memory::RVM_Scope> &ext_data);
 
@@ -174,17 +573,32 @@ namespace core::components {
 
         ExecutionStatus execute();
 
+        // ̬У飺͡תǩǶףִͨк
+        // trusted Ϊ true ʱУ RSI ļԼԣ﷨ṹתǩļ
+        void verify(const bool &trusted = false);
+
+        // ֲִУָתʱۼȶȣÿﵽһֵͷػȵָ
+        void recordHotness() {
+            if (++hotness % TIER_UP_INTERVAL == 0) {
+                tierUp();
+            }
+        }
+
+        void tierUp();
+
         void serialize(std::ostream &os, const utils::SerializationProfile &profile) const;
 
         void deserialize(std::istream &is, const utils::SerializationProfile &profile);
 
-        static DebugMode debug_mode; // л
-        static std::string file_record; // л
-        static std::stack<InsSet*> exe_stack; // л
-        static std::vector<std::shared_ptr<AtmpBlock>> atmp_stack; // л
         std::stack<std::string> scope_name_stack{}; // л
 
         bool is_delayed_release_scope{false};
+        bool is_verified{false}; // л RSI ļͷ¼
+        static constexpr size_t TIER_UP_INTERVAL = 1000;
+        size_t hotness{0}; // л
+        size_t breakpoint_epoch{0}; // лһδ򲹶ʱĶϵ汾
+        std::weak_ptr<memory::RVM_Scope> bound_ext_scope{}; // л״νչʱ
+        std::shared_ptr<MemoTable> memo_table = nullptr; // л屻 MEMO ָΪʱ
         int end_pointer{-1};
         std::string scope_prefix;
         std::string scope_leader;
@@ -197,8 +611,16 @@ namespace core::components {
 
         std::vector<std::shared_ptr<Ins>> insSet{}; // Insлעvectorл
         mutable std::unordered_map<std::string, int> set_labels{};
+        // ָڵڴλ insSet ֮󣬸ֵʱ滻ָ滻ڴʱͷָ
+        std::vector<std::shared_ptr<ProgramArena>> arenas_{};
 
         static void printDebugExeStackInfo(const bool& hasError);
+
+        void verifyScope(const RI *leader_ri, const bool &trusted);
+
+        // ִѭDebugging Ϊ false ʱκεԼ飬ϵ BreakpointTable 򲹶ʵ
+        template<bool Debugging>
+        ExecutionStatus run(const std::shared_ptr<size_t> &pointer);
     };
 
 }
@@ -271,6 +693,7 @@ namespace ris {
     /* Ƚϲָ */
     extern const RI CMP;
     extern const RI CREL;
+    extern const RI CMPJ;
 
     /* Ʋָ */
     extern const RI END;
@@ -288,6 +711,10 @@ namespace ris {
     extern const RI CALL;
     extern const RI IVOK;
     extern const RI RET;
+    extern const RI MEMO;
+    extern const RI MEMO_CLR;
+    extern const RI LIST_LIT;
+    extern const RI DICT_LIT;
 
     /* ѭָ */
     extern const RI REPEAT;
@@ -397,6 +824,10 @@ namespace ris {
 
     // TODO: 紦ָ
     // ...
+
+    // ָڹϣָԴСд -> ָ
+    using RITable = utils::PerfectHashTable<const RI *, 105, true>;
+    extern const RITable riTable;
 }
 
 // ִָк
@@ -441,6 +872,7 @@ namespace exes {
     ExecutionStatus ri_jf(const Ins &ins, size_t &pointer, const StdArgs &args);
     ExecutionStatus ri_cmp(const Ins &ins, size_t &pointer, const StdArgs &args);
     ExecutionStatus ri_crel(const Ins &ins, size_t &pointer, const StdArgs &args);
+    ExecutionStatus ri_cmpj(const Ins &ins, size_t &pointer, const StdArgs &args);
     ExecutionStatus ri_mul(const Ins &ins, size_t &pointer, const StdArgs &args);
     ExecutionStatus ri_iter_apnd(const Ins &ins, size_t &pointer, const StdArgs &args);
     ExecutionStatus ri_iter_sub(const Ins &ins, size_t &pointer, const StdArgs &args);
@@ -481,6 +913,12 @@ namespace exes {
     ExecutionStatus ri_atmp(const Ins &ins, size_t &pointer, const StdArgs &args);
     ExecutionStatus ri_expose(const Ins &ins, size_t &pointer, const StdArgs &args);
     ExecutionStatus ri_ret(const Ins &ins, size_t &pointer, const StdArgs &args);
+    ExecutionStatus ri_memo(const Ins &ins, size_t &pointer, const StdArgs &args);
+    ExecutionStatus ri_memo_clr(const Ins &ins, size_t &pointer, const StdArgs &args);
+
+    ExecutionStatus ri_list_lit(const Ins &ins, size_t &pointer, const StdArgs &args);
+
+    ExecutionStatus ri_dict_lit(const Ins &ins, size_t &pointer, const StdArgs &args);
     ExecutionStatus ri_pair_set(const Ins &ins, size_t &pointer, const StdArgs &args);
     ExecutionStatus ri_pair_set_key(const Ins &ins, size_t &pointer, const StdArgs &args);
     ExecutionStatus ri_pair_set_value(const Ins &ins, size_t &pointer, const StdArgs &args);
@@ -491,6 +929,33 @@ namespace exes {
     ExecutionStatus ri_dict_del(const Ins &ins, size_t &pointer, const StdArgs &args);
     ExecutionStatus ri_dict_keys(const Ins &ins, size_t &pointer, const StdArgs &args);
     ExecutionStatus ri_dict_values(const Ins &ins, size_t &pointer, const StdArgs &args);
+
+    // ִָкתǩ InsSet::verify ڼʱ
+    ExecutionStatus ri_put_unchecked(const Ins &ins, size_t &pointer, const StdArgs &args);
+    ExecutionStatus ri_copy_unchecked(const Ins &ins, size_t &pointer, const StdArgs &args);
+    ExecutionStatus ri_add_unchecked(const Ins &ins, size_t &pointer, const StdArgs &args);
+    ExecutionStatus ri_mul_unchecked(const Ins &ins, size_t &pointer, const StdArgs &args);
+    ExecutionStatus ri_div_unchecked(const Ins &ins, size_t &pointer, const StdArgs &args);
+    ExecutionStatus ri_pow_unchecked(const Ins &ins, size_t &pointer, const StdArgs &args);
+    ExecutionStatus ri_root_unchecked(const Ins &ins, size_t &pointer, const StdArgs &args);
+    ExecutionStatus ri_mod_unchecked(const Ins &ins, size_t &pointer, const StdArgs &args);
+    ExecutionStatus ri_opp_unchecked(const Ins &ins, size_t &pointer, const StdArgs &args);
+    ExecutionStatus ri_iter_size_unchecked(const Ins &ins, size_t &pointer, const StdArgs &args);
+    ExecutionStatus ri_iter_get_unchecked(const Ins &ins, size_t &pointer, const StdArgs &args);
+    ExecutionStatus ri_func_unchecked(const Ins &ins, size_t &pointer, const StdArgs &args);
+    ExecutionStatus ri_funi_unchecked(const Ins &ins, size_t &pointer, const StdArgs &args);
+    ExecutionStatus ri_cmp_unchecked(const Ins &ins, size_t &pointer, const StdArgs &args);
+    ExecutionStatus ri_jmp_unchecked(const Ins &ins, size_t &pointer, const StdArgs &args);
+    ExecutionStatus ri_jr_unchecked(const Ins &ins, size_t &pointer, const StdArgs &args);
+    ExecutionStatus ri_jt_unchecked(const Ins &ins, size_t &pointer, const StdArgs &args);
+    ExecutionStatus ri_jf_unchecked(const Ins &ins, size_t &pointer, const StdArgs &args);
+    ExecutionStatus ri_cmpj_unchecked(const Ins &ins, size_t &pointer, const StdArgs &args);
+
+    // ػִָк InsSet::tierUp ͷ󶨣ʧʱȥŻΪִк
+    ExecutionStatus ri_add_int_int(const Ins &ins, size_t &pointer, const StdArgs &args);
+    ExecutionStatus ri_add_float_float(const Ins &ins, size_t &pointer, const StdArgs &args);
+    ExecutionStatus ri_mul_int_int(const Ins &ins, size_t &pointer, const StdArgs &args);
+    ExecutionStatus ri_mul_float_float(const Ins &ins, size_t &pointer, const StdArgs &args);
 }
 
 
@@ -5,6 +5,11 @@
 #ifndef RVM_VERSION_H
 #define RVM_VERSION_H
 #define VERSION_MAJOR 1
-#define VERSION_MINOR 6
+#define VERSION_MINOR 7
 #define VERSION_PATCH 0
+// 可读取的最低 RSI 文件版本：1.7.0 起指令以指令表下标写出，文件头含标记字节，位置信息可按路径表写出，
+// 此前版本生成的 RSI 文件无法按当前格式解析，需重新编译
+#define RSI_MIN_VERSION_MAJOR 1
+#define RSI_MIN_VERSION_MINOR 7
+#define RSI_MIN_VERSION_PATCH 0
 #endif //RVM_VERSION_H//
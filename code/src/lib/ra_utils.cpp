@@ -738,8 +738,20 @@ namespace utils {
     }
 
     // Posʵ
-    Pos::Pos(int line, int column, std::string filepath):
-    line(line), column(column), filepath(std::move(filepath)) {}
+    Pos::Pos(int line, int column, std::string_view filepath):
+    line(line), column(column), filepath(internFilepath(filepath)) {}
+
+    const std::string *Pos::internFilepath(const std::string_view filepath) {
+        if (filepath.empty()) {
+            return nullptr;
+        }
+        // ͬһļʱ·ظһεפԱ
+        static thread_local const std::string *last = nullptr;
+        if (!last || *last != filepath) {
+            last = &SymbolTable::getName(SymbolTable::intern(filepath));
+        }
+        return last;
+    }
 
     int Pos::getLine() const {
         return line;
@@ -754,12 +766,13 @@ namespace utils {
     }
 
     std::string Pos::toString() const {
-        return filepath + ":" + std::to_string(line) + ":" + (column > 0 ? std::to_string(column) : "1") + ", line " +
+        return getFilepath() + ":" + std::to_string(line) + ":" + (column > 0 ? std::to_string(column) : "1") + ", line " +
         std::to_string(line) + (column > 1 ? ", column " + std::to_string(column) : "");
     }
 
-    std::string Pos::getFilepath() const {
-        return filepath;
+    const std::string &Pos::getFilepath() const {
+        static const std::string empty_filepath;
+        return filepath ? *filepath : empty_filepath;
     }
 
     std::string Pos::getFilePosStr() const {
@@ -772,13 +785,19 @@ namespace utils {
             out.write(reinterpret_cast<const char *>(&line), sizeof(line));
             out.write(reinterpret_cast<const char *>(&column), sizeof(column));
 
+            if (PathTable::current_) {
+                PathTable::current_->writePath(out, filepath);
+                return;
+            }
+
             // дַĳ
-            size_t filepathLength = filepath.size();
+            const auto &path = getFilepath();
+            size_t filepathLength = path.size();
             out.write(reinterpret_cast<const char *>(&filepathLength), sizeof(filepathLength));
 
             // дַ
             if (filepathLength > 0) {
-                out.write(filepath.c_str(), static_cast<long long>(filepathLength));
+                out.write(path.c_str(), static_cast<long long>(filepathLength));
             }
         }
     }
@@ -789,18 +808,74 @@ namespace utils {
             in.read(reinterpret_cast<char *>(&line), sizeof(line));
             in.read(reinterpret_cast<char *>(&column), sizeof(column));
 
+            if (PathTable::current_) {
+                filepath = PathTable::current_->readPath(in);
+                return;
+            }
+
             // ȡַĳ
             size_t filepathLength;
             in.read(reinterpret_cast<char *>(&filepathLength), sizeof(filepathLength));
 
             // ȡַ
             if (filepathLength > 0) {
-                filepath.resize(filepathLength);  // ַС
-                in.read(&filepath[0], static_cast<long long>(filepathLength));
+                static thread_local std::string path;
+                path.resize(filepathLength);
+                in.read(&path[0], static_cast<long long>(filepathLength));
+                filepath = internFilepath(path);
             } else {
-                filepath.clear();  // Ϊ0ַ
+                filepath = nullptr;  // Ϊ0·
+            }
+        }
+    }
+
+    // PathTableʵ
+    thread_local Pos::PathTable *Pos::PathTable::current_ = nullptr;
+
+    Pos::PathTable::Scope::Scope()
+        : table_(std::make_unique<PathTable>()), previous_(std::exchange(current_, table_.get())) {}
+
+    Pos::PathTable::Scope::~Scope() {
+        current_ = previous_;
+    }
+
+    void Pos::PathTable::writePath(std::ostream &out, const std::string *filepath) {
+        // ŵڱʱʾ··
+        uint32_t id = NO_PATH;
+        bool inserted = false;
+        if (filepath) {
+            const auto [it, is_new] = index_.emplace(filepath, static_cast<uint32_t>(paths_.size()));
+            id = it->second;
+            inserted = is_new;
+            if (inserted) {
+                paths_.push_back(filepath);
             }
         }
+        out.write(reinterpret_cast<const char *>(&id), sizeof(id));
+        if (inserted) {
+            const size_t filepathLength = filepath->size();
+            out.write(reinterpret_cast<const char *>(&filepathLength), sizeof(filepathLength));
+            out.write(filepath->c_str(), static_cast<long long>(filepathLength));
+        }
+    }
+
+    const std::string *Pos::PathTable::readPath(std::istream &in) {
+        uint32_t id = NO_PATH;
+        in.read(reinterpret_cast<char *>(&id), sizeof(id));
+        if (id == NO_PATH) {
+            return nullptr;
+        }
+        if (id < paths_.size()) {
+            return paths_[id];
+        }
+        if (id != paths_.size()) {
+            throw std::runtime_error("Deserialization failed: invalid path table entry");
+        }
+        size_t filepathLength = 0;
+        in.read(reinterpret_cast<char *>(&filepathLength), sizeof(filepathLength));
+        std::string path(filepathLength, '\0');
+        in.read(&path[0], static_cast<long long>(filepathLength));
+        return paths_.emplace_back(internFilepath(path));
     }
 
     ArgType getArgType(const std::string &str) {
@@ -839,18 +914,48 @@ namespace utils {
         return "[ArgType: " + getArgTypeName(argType) + "]";
     }
 
+    // ArgTextTableʵ
+    thread_local ArgTextTable *ArgTextTable::current_ = nullptr;
+
+    ArgTextTable::Scope::Scope(ArgTextTable &table) : previous_(std::exchange(current_, &table)) {}
+
+    ArgTextTable::Scope::~Scope() {
+        current_ = previous_;
+    }
+
+    const std::string *ArgTextTable::add(std::string text) {
+        if (!current_) {
+            throw std::logic_error("Argument text can only be added while an argument text table is open.");
+        }
+        return &current_->texts_.emplace_back(std::move(text));
+    }
+
     // Argʵ
     Arg::Arg(Pos pos, const std::string &value)
-        :pos(std::move(pos)), value(value)
+        :pos(std::move(pos))
     {
         this->type = getArgType(value);
+        std::string text = value;
         if (this->type == ArgType::string){
-            StringManager::parseStringFormat_nret(this->value);
+            StringManager::parseStringFormat_nret(text);
+        }
+        setValue(std::move(text));
+    }
+
+    void Arg::setValue(std::string text) {
+        if (type == ArgType::identifier || type == ArgType::keyword) {
+            symbol = SymbolTable::intern(text);
+            value = &SymbolTable::getName(symbol);
         } else {
-            this->value = value;
+            symbol = SymbolTable::NO_SYMBOL;
+            value = text.empty() ? nullptr : ArgTextTable::add(std::move(text));
         }
     }
 
+    Symbol Arg::getSymbol() const {
+        return symbol;
+    }
+
     const Pos &Arg::getPos() const {
         return pos;
     }
@@ -864,7 +969,8 @@ namespace utils {
     }
 
     const std::string &Arg::getValue() const {
-        return value;
+        static const std::string empty_value;
+        return value ? *value : empty_value;
     }
 
     std::string Arg::toString() const {
@@ -872,11 +978,11 @@ namespace utils {
             case ArgType::unknown:
             case ArgType::identifier:
             case ArgType::keyword:
-                return "[Arg(" + utils::getArgTypeName(type) + "): '" + value + "']";
+                return "[Arg(" + utils::getArgTypeName(type) + "): '" + getValue() + "']";
             case ArgType::number:
-                return "[Arg(" + utils::getArgTypeName(type) + "): " + value + "]";
+                return "[Arg(" + utils::getArgTypeName(type) + "): " + getValue() + "]";
             case ArgType::string:
-                return "[Arg(" + utils::getArgTypeName(type) + "): \"" + value + "\"]";
+                return "[Arg(" + utils::getArgTypeName(type) + "): \"" + getValue() + "\"]";
         }
         return "Error";
     }
@@ -892,12 +998,13 @@ namespace utils {
         utils::serializeArgType(out, type, profile);
 
         // лַĳ
-        size_t valueLength = value.size();
+        const auto &text = getValue();
+        size_t valueLength = text.size();
         out.write(reinterpret_cast<const char*>(&valueLength), sizeof(valueLength));
 
         // лַ
         if (valueLength > 0) {
-            out.write(value.c_str(), static_cast<long long>(valueLength));
+            out.write(text.c_str(), static_cast<long long>(valueLength));
         }
     }
 
@@ -914,12 +1021,42 @@ namespace utils {
         in.read(reinterpret_cast<char*>(&valueLength), sizeof(valueLength));
 
         // лַ
+        std::string text(valueLength, '\0');
         if (valueLength > 0) {
-            value.resize(valueLength);
-            in.read(&value[0], static_cast<long long>(valueLength));
-        } else {
-            value.clear();
+            in.read(&text[0], static_cast<long long>(valueLength));
         }
+
+        // űŽڽЧ˰פ
+        setValue(std::move(text));
+    }
+
+    SymbolTable &SymbolTable::getInstance() {
+        static SymbolTable instance;
+        return instance;
+    }
+
+    Symbol SymbolTable::intern(const std::string_view name) {
+        auto &table = getInstance();
+        std::lock_guard lock(table.mutex_);
+        if (const auto it = table.index_.find(name); it != table.index_.end()) {
+            return it->second;
+        }
+        const auto symbol = static_cast<Symbol>(table.names_.size());
+        const auto &stored = table.names_.emplace_back(name);
+        table.index_.emplace(stored, symbol);
+        return symbol;
+    }
+
+    const std::string &SymbolTable::getName(const Symbol symbol) {
+        auto &table = getInstance();
+        std::lock_guard lock(table.mutex_);
+        return table.names_.at(symbol);
+    }
+
+    size_t SymbolTable::size() {
+        auto &table = getInstance();
+        std::lock_guard lock(table.mutex_);
+        return table.names_.size();
     }
 
     std::string readFile(const std::string &filepath) {
@@ -1575,7 +1712,7 @@ namespace utils {
     }
 
     void appendProgramWorkingDir(const std::string &path) {
-        base::PROGRAM_WORKING_DIRECTORY_STACK.push(getAbsolutePath(getFileDirFromPath(path)));
+        base::getProgramWorkingDirectoryStack().push(getAbsolutePath(getFileDirFromPath(path)));
     }
 
 } // utils
\ No newline at end of file
@@ -22,7 +22,7 @@
 namespace base {
 
     void RVMSerialHeader::serialize(std::ostream &out) const {
-        if (profile < static_cast<uint16_t>(utils::SerializationProfile::Minified)) {
+        if (profile < static_cast<uint8_t>(utils::SerializationProfile::Minified)) {
             out.write(reinterpret_cast<const char *>(this), sizeof(RVMSerialHeader));
             if (out.bad() || out.fail()) {
                 throw std::runtime_error("Serialization failed");
@@ -41,7 +41,8 @@ namespace base {
                 validate(file_path);
             }
         } else {
-            profile = static_cast<uint16_t>(utils::SerializationProfile::Minified);
+            profile = static_cast<uint8_t>(utils::SerializationProfile::Minified);
+            flags = 0;
         }
     }
 
@@ -50,10 +51,23 @@ namespace base {
         if (memcmp(magic, expected_magic, sizeof(expected_magic)) != 0) {  // ̶ʹ expected_magic ĳ
             throw std::runtime_error("Invalid file format!");
         }
-        if (major_ver > VERSION_MAJOR || minor_ver > VERSION_MINOR || patch_ver > VERSION_PATCH) {
+        // Ρ޶汾αȽ
+        constexpr auto packVersion = [](const uint64_t major, const uint64_t minor, const uint64_t patch) {
+            return major << 32 | minor << 16 | patch;
+        };
+        const auto file_version = packVersion(major_ver, minor_ver, patch_ver);
+        if (file_version > packVersion(VERSION_MAJOR, VERSION_MINOR, VERSION_PATCH)) {
             throw std::runtime_error("Unsupported version\nRVM version: " + getRVMVersionInfo() + "\nRSI File Version: " +
                                              getRSIVersionInfo(file_path));
         }
+        if (file_version < packVersion(RSI_MIN_VERSION_MAJOR, RSI_MIN_VERSION_MINOR, RSI_MIN_VERSION_PATCH)) {
+            throw std::runtime_error("Outdated RSI format\nRVM version: " + getRVMVersionInfo() + "\nRSI File Version: " +
+                                     getRSIVersionInfo(file_path) + "\nThe RSI format changed in v" +
+                                     std::to_string(RSI_MIN_VERSION_MAJOR) + "." +
+                                     std::to_string(RSI_MIN_VERSION_MINOR) + "." +
+                                     std::to_string(RSI_MIN_VERSION_PATCH) +
+                                     ", recompile the source file with the current RVM.");
+        }
     }
 
     utils::SerializationProfile RVMSerialHeader::getProfile() const {
@@ -61,7 +75,23 @@ namespace base {
     }
 
     void RVMSerialHeader::setProfile(const utils::SerializationProfile &profile_) {
-        this->profile = static_cast<uint16_t>(profile_);
+        this->profile = static_cast<uint8_t>(profile_);
+    }
+
+    bool RVMSerialHeader::isVerified() const {
+        return flags & FLAG_VERIFIED;
+    }
+
+    void RVMSerialHeader::setVerified(const bool &verified) {
+        flags = static_cast<uint8_t>(verified ? flags | FLAG_VERIFIED : flags & ~FLAG_VERIFIED);
+    }
+
+    bool RVMSerialHeader::hasPathTable() const {
+        return flags & FLAG_PATH_TABLE;
+    }
+
+    void RVMSerialHeader::setPathTable(const bool &path_table) {
+        flags = static_cast<uint8_t>(path_table ? flags | FLAG_PATH_TABLE : flags & ~FLAG_PATH_TABLE);
     }
 
     std::string RVMSerialHeader::getRVMVersionInfo()
@@ -159,9 +189,11 @@ namespace base {
 
     const std::string PROGRAM_RVM_DIRECTORY = utils::getRVMDir();
     const std::string PROGRAM_ENVIRONMENT_DIRECTORY = utils::getRVMDir();
-    std::stack<std::string> PROGRAM_WORKING_DIRECTORY_STACK {};
+    std::stack<std::string> &getProgramWorkingDirectoryStack() {
+        return ThreadBound<WorkingDirectories>::current().stack;
+    }
 
-    bool PROGRAM_INTERRUPTED = false;
+    volatile std::sig_atomic_t PROGRAM_INTERRUPTED = 0;
 
     std::unordered_map<std::string, Relational> relationalMap = {
             {"RG",  Relational::RG},
@@ -217,7 +249,7 @@ namespace base {
         }
     }
 
-    int RVM_ID::counter = 0;
+    std::atomic<int> RVM_ID::counter = 0;
 
     RVM_ID::RVM_ID(char sign, IDType idType)
             : sign(sign), uid(++counter), idType(idType) {
@@ -349,18 +381,14 @@ namespace base {
         }
     }
 
-    RVM_IO *RVM_IO::instance = nullptr;
-
     RVM_IO::RVM_IO(int threshold_size) : toConsole(true), toFile(false),
                                          bufferThreshold(1024 * threshold_size),
-                                         currentSize(0) {}  // Ĭֵ 20kb
+                                         currentSize(0) {
+        std::signal(SIGINT, handleSigInt);
+    }  // Ĭֵ 20kb
 
     RVM_IO *RVM_IO::getInstance() {
-        if (instance == nullptr) {
-            std::signal(SIGINT, handleSigInt);
-            instance = new RVM_IO();
-        }
-        return instance;
+        return &ThreadBound<RVM_IO>::current();
     }
 
     void RVM_IO::setOutputToConsole(bool enable) {
@@ -369,6 +397,7 @@ namespace base {
 
     void RVM_IO::setOutputToFile(const std::string &filename) {
         if (fileStream.is_open()) {
+            waitFileWrites();
             fileStream.close();
         }
 
@@ -416,19 +445,31 @@ namespace base {
 
         // ʹ̳߳첽ִļд
         if (toFile && fileStream.is_open()) {
+            {
+                std::lock_guard<std::mutex> lock(fileWriteMutex);
+                ++pendingFileWrites;
+            }
             threadPool.enqueue([this, normalContent, errorContent]() {
                 std::lock_guard<std::mutex> lock(fileWriteMutex);
                 fileStream << normalContent << errorContent;
                 fileStream.flush();
+                if (--pendingFileWrites == 0) {
+                    fileWritesDone.notify_all();
+                }
             });
         }
     }
 
+    void RVM_IO::waitFileWrites() {
+        std::unique_lock<std::mutex> lock(fileWriteMutex);
+        fileWritesDone.wait(lock, [this] { return pendingFileWrites == 0; });
+    }
+
     void RVM_IO::handleSigInt(const int signal)
     {
         if (signal == SIGINT)
         {
-            PROGRAM_INTERRUPTED = true;
+            PROGRAM_INTERRUPTED = 1;
             std::signal(SIGINT, handleSigInt);
         }
     }
@@ -436,10 +477,9 @@ namespace base {
     RVM_IO::~RVM_IO() {
         flushOutputCache();  // ȷݶ
         if (fileStream.is_open()) {
+            waitFileWrites();
             fileStream.close();
         }
-        delete instance;
-        instance = nullptr;
         inputCache.clear();
     }
 
@@ -510,6 +550,8 @@ namespace base {
             {ErrorType::FileError,      "FileError"},
             {ErrorType::IDError,        "IDError"},
             {ErrorType::LinkError,      "LinkError"},
+            {ErrorType::TimeoutError,   "TimeoutError"},
+            {ErrorType::InterruptError, "InterruptError"},
             {ErrorType::KeyError,       "KeyError"},
             {ErrorType::FieldError,     "FieldError"}
     };
@@ -627,36 +669,19 @@ namespace base {
         }
     }
 
-    bool containsKeyword(const std::string &keyword) {
-        for (const auto &val: categorizedKeywords | std::views::values) {
-            if (const auto &keywords = val;
-                keywords.contains(keyword)) {
-                return true;
-            }
-        }
-        return false;
+    bool containsKeyword(const std::string_view keyword) {
+        return keywordTable.contains(keyword);
     }
 
-    bool containsKeywordInCategory(const KeywordType &category, const std::string &keyword) {
-        // ȡ
-        const std::string &categoryName = getKeywordTypeName(category);
-
-        // ȡĹؼּ
-        const auto &keywords = categorizedKeywords[categoryName];
-
-        // ҹؼ
-        return keywords.contains(keyword);
+    bool containsKeywordInCategory(const KeywordType &category, const std::string_view keyword) {
+        const auto category_ = keywordTable.find(keyword);
+        return category_ && *category_ == category;
     }
 
     std::string getKeywordTypeFormatString(const KeywordType &keywordType){
         return "[KeywordType: " + getKeywordTypeName(keywordType) + "]";
     }
 
-    void addKeywordInCategory(const KeywordType &category, const std::string &keyword) {
-        const std::string &categoryName = getKeywordTypeName(category);
-        categorizedKeywords[categoryName].insert(keyword);
-    }
-
     std::string OpModeTools::getOpModeString(const OpMode &opMode) {
         switch (opMode) {
             case OpMode::Add:
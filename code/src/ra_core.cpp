@@ -6,11 +6,10 @@
 #include <cmath>
 #include <utility>
 #include <cstdio>
+#include <iomanip>
 #include "../include/ra_base.h"
 #include "../include/ra_core.h"
 
-core::memory::RVM_Memory &core::memory::data_space_pool = RVM_Memory::getInstance();
-
 namespace core::id {
     TypeID::TypeID(std::string type_name, const base::IDType &idType, const std::string &dtype_ident)
             : RVM_ID('T', idType), type_name(std::move(type_name)), dtype_ident(dtype_ident) {}
@@ -91,52 +90,63 @@ namespace core::id {
 
     DataID::DataID() : RVM_ID('D', base::IDType::Data) {}
 
-    DataID::DataID(std::string name, std::string spaceName) : RVM_ID('D', base::IDType::Data),
-                                                              name_(std::move(name)),
-                                                              scopeName_(std::move(spaceName)),
-                                                              index_(generateIndex()){
-        size_t reserveSize = name_.size() + 1 +
-                             (scopeName_.empty() ? 0 : scopeName_.size() + 1) +
-                             std::to_string(index_).size();
-        idstring.reserve(reserveSize);
-        idstring += name_;
-        if (scopeName_.empty()) {
-            idstring += '#';
-            idstring += std::to_string(index_);
-        } else {
+    DataID::DataID(const std::string &name) : RVM_ID('D', base::IDType::Data),
+                                              symbol_(utils::SymbolTable::intern(name)) {}
+
+    DataID::DataID(const utils::Symbol symbol, const uint32_t scopeId, const uint32_t slot, const uint32_t generation)
+            : RVM_ID('D', base::IDType::Data),
+              packed_(static_cast<uint64_t>(scopeId) << (SLOT_BITS + GENERATION_BITS) |
+                      static_cast<uint64_t>(slot) << GENERATION_BITS |
+                      (generation & GENERATION_MASK)),
+              symbol_(symbol) {}
+
+    std::string DataID::getIdString() const {
+        std::string idstring = getName();
+        if (const auto scope = memory::RVM_Scope::findById(getScopeId())) {
             idstring += '@';
-            idstring += scopeName_;
+            idstring += scope->getName();
             idstring += '#';
-            idstring += std::to_string(index_);
+            idstring += std::to_string(getSlot());
         }
+        return idstring;
     }
 
     std::string DataID::toFullString() const {
-        return RVM_ID::toString("Data(" + idstring + ")");
+        return RVM_ID::toString("Data(" + getIdString() + ")");
     }
 
-    const std::string &DataID::getName() const { return name_; }
+    const std::string &DataID::getName() const {
+        static const std::string unnamed;
+        return symbol_ == utils::SymbolTable::NO_SYMBOL ? unnamed : utils::SymbolTable::getName(symbol_);
+    }
 
-    const std::string &DataID::getScopeName() const { return scopeName_; }
+    utils::Symbol DataID::getSymbol() const { return symbol_; }
 
-    size_t DataID::getIndex() const { return index_; }
+    uint32_t DataID::getScopeId() const {
+        return static_cast<uint32_t>(packed_ >> (SLOT_BITS + GENERATION_BITS));
+    }
+
+    uint32_t DataID::getSlot() const {
+        return static_cast<uint32_t>(packed_ >> GENERATION_BITS) & MAX_SLOT;
+    }
+
+    uint32_t DataID::getGeneration() const {
+        return static_cast<uint32_t>(packed_) & GENERATION_MASK;
+    }
+
+    uint64_t DataID::getPacked() const { return packed_; }
 
     void DataID::printInfo() const {
-        std::cout << "DataID: " << idstring << std::endl;
+        std::cout << "DataID: " << getIdString() << std::endl;
     }
 
     bool DataID::operator==(const DataID &other) const {
-        return index_ == other.index_;
+        return packed_ == other.packed_ && symbol_ == other.symbol_;
     }
 
     std::string DataID::toString() const {
         return RVM_ID::toString("Data");
     }
-
-    size_t DataID::generateIndex() {
-        static std::atomic<size_t> counter{0};
-        return counter++;
-    }
 }
 
 core::data::ExtensionType core::data::ExtensionTypeTools::getExtensionType(const std::string &extension_path) {
@@ -380,6 +390,10 @@ namespace core::data {
         return value;
     }
 
+    void Int::setValue(const int newValue) noexcept {
+        value = newValue;
+    }
+
     id::TypeID &Int::getTypeID() const {
         return typeId;
     }
@@ -570,6 +584,10 @@ namespace core::data {
         return value;
     }
 
+    void Float::setValue(const double newValue) noexcept {
+        value = newValue;
+    }
+
     id::TypeID &Float::getTypeID() const {
         return typeId;
     }
@@ -734,7 +752,9 @@ namespace core::data {
     id::TypeID String::typeId{"String", std::make_shared<id::TypeID>(Iterable::typeId), base::IDType::String, tp_str};
 
     String::String(std::string  value) :
-        value(std::move(value)) {}
+        HeapAccount(memory::HeapCategory::String), value(std::move(value)) {
+        recharge();
+    }
 
     std::string String::getTypeName() const {
         return "String";
@@ -764,13 +784,14 @@ namespace core::data {
         if (typeId.fullEqualWith(newData->getTypeID())) {
             const auto newString = std::static_pointer_cast<const String>(newData);
             this->value = newString->value;
+            recharge();
             return true;
         }
         return false;
     }
 
     std::shared_ptr<base::RVM_Data> String::copy_ptr() const {
-        return std::make_shared<String>(String(value));
+        return std::make_shared<String>(value);
     }
 
     bool String::compare(const std::shared_ptr<RVM_Data> &other, const base::Relational &relational) const {
@@ -804,6 +825,7 @@ namespace core::data {
 
     void String::append(const std::shared_ptr<RVM_Data> &data) {
         value += data->getValStr();
+        recharge();
     }
 
     std::shared_ptr<Iterable> String::subpart(const int begin, const int end) {
@@ -883,6 +905,7 @@ namespace core::data {
         }
         if (data->getTypeID() == Char::typeId){
             value.insert(value.begin() + index, static_pointer_cast<const Char>(data)->getValue());
+            recharge();
         } else {
             throw base::errors::DataTypeMismatchError(unknown_, unknown_, {}, {});
         }
@@ -910,6 +933,7 @@ namespace core::data {
                 "Data of 'tp-str' type can only be concatenated with data of 'tp-str' type."});
         }
         value += other->getValStr();
+        recharge();
     }
 
     bool String::contains(const std::shared_ptr<RVM_Data>& data)
@@ -924,9 +948,13 @@ namespace core::data {
         return value.find(static_pointer_cast<const Char>(data)->getValue()) != std::string::npos;
      }
 
+    size_t String::payloadBytes() const {
+        return value.capacity();
+    }
+
     id::TypeID List::typeId("List", std::make_shared<id::TypeID>(Iterable::typeId), base::IDType::List, tp_list);
 
-    List::List() {}
+    List::List(): HeapAccount(memory::HeapCategory::List) {}
 
     void List::begin() const {
 
@@ -943,6 +971,7 @@ namespace core::data {
     bool List::updateData(const std::shared_ptr<RVM_Data> &newData) {
         if (typeId.fullEqualWith(newData->getTypeID())) {
             this->dataList = static_pointer_cast<const List>(newData)->dataList;
+            recharge();
             return true;
         } else {
             return false;
@@ -952,6 +981,7 @@ namespace core::data {
     std::shared_ptr<base::RVM_Data> List::copy_ptr() const {
         auto newList = std::make_shared<List>();
         newList->dataList = this->dataList;
+        newList->recharge();
         return newList;
     }
 
@@ -981,17 +1011,19 @@ namespace core::data {
 
     void List::append(const std::shared_ptr<RVM_Data> &data) {
         dataList.push_back(data);
+        recharge();
     }
 
     std::shared_ptr<Iterable> List::subpart(const int begin, const int end) {
         auto subList = std::make_shared<List>();
         subList->dataList.assign(dataList.begin() + begin, dataList.begin() + end);
+        subList->recharge();
         return subList;
     }
 
-    std::vector<int> main_container_ids{};
+    thread_local std::vector<int> main_container_ids{};
 
-    bool is_getting_std_str = false;
+    thread_local bool is_getting_std_str = false;
 
     std::string List::getValStdStr(const base::RVM_ID &main_container_id,
                                    const std::string &prefix, const std::string &suffix) const {
@@ -1064,7 +1096,10 @@ namespace core::data {
         return dataList;
     }
 
-    List::List(const std::vector<std::shared_ptr<RVM_Data>> &dataList): dataList(std::move(dataList)) {}
+    List::List(const std::vector<std::shared_ptr<RVM_Data>> &dataList):
+        HeapAccount(memory::HeapCategory::List), dataList(std::move(dataList)) {
+        recharge();
+    }
 
     void List::insertDataAt(int index, const std::shared_ptr<RVM_Data> &data) {
         if (index < 0){
@@ -1074,6 +1109,7 @@ namespace core::data {
             throw base::errors::IndexOutOfRangeError(unknown_, unknown_, {}, {});
         }
         dataList.insert(dataList.begin() + index, data);
+        recharge();
     }
 
     base::RVM_ID &List::getTypeID() const {
@@ -1095,6 +1131,7 @@ namespace core::data {
         }
         const auto &list = std::static_pointer_cast<List>(other);
         this->dataList.insert(this->dataList.end(), list->dataList.begin(), list->dataList.end());
+        recharge();
     }
 
     bool List::contains(const std::shared_ptr<RVM_Data>& data)
@@ -1102,9 +1139,23 @@ namespace core::data {
         return std::ranges::find(this->dataList, data) != this->dataList.end();
     }
 
+    void List::traceChildren(const std::function<void(const base::RVM_Data *)> &visit) const {
+        for (const auto &data: dataList) {
+            visit(data.get());
+        }
+    }
+
+    void List::clearChildren() {
+        dataList.clear();
+    }
+
+    size_t List::payloadBytes() const {
+        return dataList.capacity() * sizeof(std::shared_ptr<RVM_Data>);
+    }
+
     id::TypeID Dict::typeId{"Dict", std::make_shared<id::TypeID>(Iterable::typeId), base::IDType::Dict, tp_dict};
 
-    Dict::Dict() {}
+    Dict::Dict(): HeapAccount(memory::HeapCategory::Dict) {}
 
     void Dict::begin() const {
 
@@ -1134,6 +1185,7 @@ namespace core::data {
             !this->dataDict.contains(key)) {
             this->dataDict[key] = kvPair;
             this->keyList.push_back(key);
+            recharge();
         } else {
             throw base::errors::DuplicateKeyError(unknown_, unknown_, {}, {});
         }
@@ -1189,6 +1241,7 @@ namespace core::data {
         }
         dataDict.erase(keyList[index]);
         keyList.erase(keyList.begin() + index);
+        recharge();
     }
 
     std::string Dict::getValStr() const {
@@ -1212,6 +1265,7 @@ namespace core::data {
             const auto &otherDict = static_pointer_cast<Dict>(newData);
             this->keyList = otherDict->keyList;
             this->dataDict = otherDict->dataDict;
+            recharge();
             return true;
         }
         return false;
@@ -1251,7 +1305,9 @@ namespace core::data {
 
     Dict::Dict(std::unordered_map<std::string, std::shared_ptr<KeyValuePair>> dataDict,
                std::vector<std::string> keyList)
-            : dataDict(std::move(dataDict)), keyList(std::move(keyList)){}
+            : HeapAccount(memory::HeapCategory::Dict), dataDict(std::move(dataDict)), keyList(std::move(keyList)) {
+        recharge();
+    }
 
     std::shared_ptr<base::RVM_Data> Dict::getDataAt(const std::string &key) {
         if (!dataDict.contains(key)) {
@@ -1264,6 +1320,7 @@ namespace core::data {
         if (!dataDict.contains(key)) {
             dataDict[key] = data;
             keyList.push_back(key);
+            recharge();
         } else {
             dataDict[key] = data;
         }
@@ -1275,9 +1332,10 @@ namespace core::data {
         }
         dataDict.erase(key);
         keyList.erase(std::ranges::find(keyList, key));
+        recharge();
     }
 
-    Dict::Dict(const std::shared_ptr<List>& list) {
+    Dict::Dict(const std::shared_ptr<List>& list): HeapAccount(memory::HeapCategory::Dict) {
         if (!list) {
             throw std::invalid_argument("List pointer is null");
         }
@@ -1291,6 +1349,7 @@ namespace core::data {
                 key, list->getDataAt(i));
             keyList.push_back(keyStr);
         }
+        recharge();
     }
 
     std::string Dict::toEscapedString() const {
@@ -1310,6 +1369,7 @@ namespace core::data {
         const auto &new_kvp = std::static_pointer_cast<KeyValuePair>(data);
         keyList.insert(keyList.begin() + index, new_kvp->getKey()->getValStr());
         dataDict.insert(std::make_pair(new_kvp->getKey()->getValStr(), new_kvp));
+        recharge();
     }
 
     base::RVM_ID &Dict::getTypeID() const {
@@ -1382,6 +1442,23 @@ namespace core::data {
         return std::make_shared<List>(valueListData);
     }
 
+    void Dict::traceChildren(const std::function<void(const base::RVM_Data *)> &visit) const {
+        for (const auto &kvp: dataDict | std::views::values) {
+            visit(kvp.get());
+        }
+    }
+
+    void Dict::clearChildren() {
+        dataDict.clear();
+        keyList.clear();
+    }
+
+    size_t Dict::payloadBytes() const {
+        using Node = decltype(dataDict)::value_type;
+        return dataDict.size() * (sizeof(Node) + sizeof(void *)) + dataDict.bucket_count() * sizeof(void *)
+               + keyList.capacity() * sizeof(std::string);
+    }
+
     id::TypeID Series::typeId{"Series", std::make_shared<id::TypeID>(data::Iterable::typeId), base::IDType::Series, tp_series};
 
     Series::Series() {}
@@ -1389,6 +1466,7 @@ namespace core::data {
     std::shared_ptr<base::RVM_Data> Series::copy_ptr() const {
         const auto &newSeries = std::make_shared<Series>();
         newSeries->dataList = dataList;
+        newSeries->recharge();
         return newSeries;
     }
 
@@ -1399,6 +1477,7 @@ namespace core::data {
     bool Series::updateData(const std::shared_ptr<RVM_Data> &newData) {
         if (newData->getTypeID().fullEqualWith(Series::typeId)){
             dataList = std::static_pointer_cast<Series>(newData)->dataList;
+            recharge();
             return true;
         }
         return false;
@@ -1446,6 +1525,7 @@ namespace core::data {
     Series::Series(const std::shared_ptr<RVM_Data>& list) {
         if (list->getTypeID().fullEqualWith(List::typeId)){
             dataList = std::move(static_pointer_cast<List>(list)->getDataList());
+            recharge();
         } else {
             throw base::errors::DataTypeMismatchError(unknown_, unknown_, {}, {});
         }
@@ -1561,6 +1641,16 @@ namespace core::data {
                 value->getInstID().toString() : value->toEscapedString());
     }
 
+    void KeyValuePair::traceChildren(const std::function<void(const base::RVM_Data *)> &visit) const {
+        visit(key.get());
+        visit(value.get());
+    }
+
+    void KeyValuePair::clearChildren() {
+        key = nullptr;
+        value = nullptr;
+    }
+
     id::TypeID CompareGroup::typeId{"CompareGroup", base::IDType::CompareGroup, undefined_};
 
     CompareGroup::CompareGroup(std::shared_ptr<id::DataID> dataLeft, std::shared_ptr<id::DataID> dataRight)
@@ -1630,14 +1720,14 @@ namespace core::data {
 
     bool CompareGroup::compare(const base::Relational &relational) const
     {
-        const auto leftData = memory::data_space_pool.findDataByIDNoLock(*compLeft);
-        const auto rightData = memory::data_space_pool.findDataByIDNoLock(*compRight);
+        const auto leftData = memory::data_space_pool().findDataByIDNoLock(*compLeft);
+        const auto rightData = memory::data_space_pool().findDataByIDNoLock(*compRight);
         return leftData->compare(rightData, relational);
     }
 
     bool CompareGroup::convertToBool() const {
-        const auto leftData = memory::data_space_pool.findDataByIDNoLock(*compLeft);
-        const auto rightData = memory::data_space_pool.findDataByIDNoLock(*compRight);
+        const auto leftData = memory::data_space_pool().findDataByIDNoLock(*compLeft);
+        const auto rightData = memory::data_space_pool().findDataByIDNoLock(*compRight);
         return leftData->convertToBool() && rightData->convertToBool();
     }
 
@@ -1801,6 +1891,22 @@ namespace core::data {
         return typeId.toString(typeName + "@" + instID.getIDString());
     }
 
+    void CustomType::traceChildren(const std::function<void(const base::RVM_Data *)> &visit) const {
+        visit(parentType.get());
+        for (const auto &data: tpFields | std::views::values) {
+            visit(data.get());
+        }
+        for (const auto &data: instFields | std::views::values) {
+            visit(data.get());
+        }
+    }
+
+    void CustomType::clearChildren() {
+        parentType = nullptr;
+        tpFields.clear();
+        instFields.clear();
+    }
+
     bool CustomType::hasInstField(const std::string &fieldName) {
         if (instFields.contains(fieldName)){
             return true;
@@ -1857,7 +1963,7 @@ namespace core::data {
     id::TypeID CustomInst::typeId{"CustomInst", base::IDType::CustomTypeInst, undefined_};
 
     CustomInst::CustomInst(std::shared_ptr<CustomType> instType)
-            : customType(std::move(instType)){
+            : HeapAccount(memory::HeapCategory::CustomInst), customType(std::move(instType)){
         for (auto cur_type = customType; cur_type != nullptr; cur_type = cur_type->parentType){
             auto& type_fields = instFields[cur_type->typeName]; // 一次map访问
             type_fields.reserve(cur_type->instFields.size());
@@ -1865,6 +1971,7 @@ namespace core::data {
                 type_fields.emplace(field_name, field_data->copy_ptr());
             }
         }
+        recharge();
     }
 
     bool CustomInst::updateData(const std::shared_ptr<RVM_Data> &newData) {
@@ -1872,6 +1979,7 @@ namespace core::data {
             if (auto newCustomStruct = static_pointer_cast<const CustomInst>(newData)){
                 customType = newCustomStruct->customType;
                 instFields = newCustomStruct->instFields;
+                recharge();
                 return true;
             } else {
                 return false;
@@ -1904,6 +2012,7 @@ namespace core::data {
     std::shared_ptr<base::RVM_Data> CustomInst::copy_ptr() const {
         auto new_inst = std::make_shared<CustomInst>(this->customType);
         new_inst->instFields = instFields;
+        new_inst->recharge();
         return new_inst;
     }
 
@@ -1967,6 +2076,7 @@ namespace core::data {
                         [fieldName, &fieldData, this](const std::shared_ptr<CustomType> &curType) -> bool {
                     if (curType->hasInstFieldItself(fieldName)) {
                         instFields[customType->typeName].emplace(fieldName, fieldData);
+                        recharge();
                         return true;
                     }
                     if (curType->hasTpFieldItself(fieldName)) {
@@ -2012,12 +2122,38 @@ namespace core::data {
                 cur_type = cur_type->parentType;
             }
             customType = childType;  // 最后更新customType
+            recharge();
         } else {
             throw base::errors::DataTypeMismatchError(unknown_, unknown_,
                                                   {}, {});
         }
     }
 
+    void CustomInst::traceChildren(const std::function<void(const base::RVM_Data *)> &visit) const {
+        visit(customType.get());
+        for (const auto &fields: instFields | std::views::values) {
+            for (const auto &data: fields | std::views::values) {
+                visit(data.get());
+            }
+        }
+    }
+
+    void CustomInst::clearChildren() {
+        instFields.clear();
+        customType = nullptr;
+    }
+
+    size_t CustomInst::payloadBytes() const {
+        using TypeNode = decltype(instFields)::value_type;
+        using FieldNode = TypeNode::second_type::value_type;
+        size_t bytes = instFields.bucket_count() * sizeof(void *);
+        for (const auto &fields: instFields | std::views::values) {
+            bytes += sizeof(TypeNode) + sizeof(void *)
+                     + fields.size() * (sizeof(FieldNode) + sizeof(void *)) + fields.bucket_count() * sizeof(void *);
+        }
+        return bytes;
+    }
+
     id::TypeID Callable::typeId{"Callable", base::IDType::Callable, tp_func};
 
     std::string Callable::getValStr() const {
@@ -2047,7 +2183,7 @@ namespace core::data {
               quoteDataID(quoteDataID){}
 
     std::string Quote::getValStr() const {
-        const auto &value_data = memory::data_space_pool.findDataByIDNoLock(quoteDataID);
+        const auto &value_data = memory::data_space_pool().findDataByIDNoLock(quoteDataID);
         if (value_data == nullptr){
             return this->quotedDataIDString;
         }
@@ -2076,7 +2212,7 @@ namespace core::data {
     }
 
     bool Quote::compare(const std::shared_ptr<RVM_Data> &other, const base::Relational &relational) const {
-        auto quotedData = memory::data_space_pool.findDataByIDNoLock(quoteDataID);
+        auto quotedData = memory::data_space_pool().findDataByIDNoLock(quoteDataID);
         return quotedData->compare(other, relational);
     }
 
@@ -2086,7 +2222,7 @@ namespace core::data {
 
     void Quote::updateQuoteData(const std::shared_ptr<RVM_Data> &newData) const
     {
-        memory::data_space_pool.updateDataNoLock(quoteDataID, newData);
+        memory::data_space_pool().updateDataNoLock(quoteDataID, newData);
     }
 
     std::shared_ptr<base::RVM_Data> Quote::getQuotedData() const {
@@ -2530,21 +2666,307 @@ namespace core::data {
 }
 
 namespace core::memory{
-    std::unordered_map<std::string, std::shared_ptr<core::data::Extension>> loadedExtensions {};
+    Traceable::Traceable() {
+        CycleCollector::track(this);
+    }
+
+    Traceable::Traceable(const Traceable &other): std::enable_shared_from_this<Traceable>(other) {
+        CycleCollector::track(this);
+    }
+
+    Traceable &Traceable::operator=(const Traceable &) {
+        // 登记位置属于对象本身，赋值时保持不变
+        return *this;
+    }
+
+    Traceable::~Traceable() {
+        CycleCollector::untrack(this);
+    }
+
+    int CycleCollector::threshold = 10000;
+
+    void CycleCollector::track(Traceable *object) {
+        auto &collector = state();
+        std::lock_guard lock(collector.mutex);
+        object->collector_ = &collector;
+        object->tracked_index_ = collector.tracked.size();
+        collector.tracked.push_back(object);
+        ++collector.allocations;
+    }
+
+    void CycleCollector::untrack(Traceable *object) {
+        auto &collector = *object->collector_;
+        std::lock_guard lock(collector.mutex);
+        const auto index = object->tracked_index_;
+        collector.tracked[index] = collector.tracked.back();
+        collector.tracked[index]->tracked_index_ = index;
+        collector.tracked.pop_back();
+    }
+
+    void CycleCollector::collectIfNeeded() {
+        if (threshold <= 0) {
+            return;
+        }
+        auto &collector = state();
+        {
+            std::lock_guard lock(collector.mutex);
+            if (collector.allocations < std::max<size_t>(threshold, collector.next_trigger)) {
+                return;
+            }
+        }
+        collect();
+    }
+
+    size_t CycleCollector::collect() {
+        const auto start_time = std::chrono::steady_clock::now();
+        auto &collector = state();
+        // 持有全部可获取的容器，回收期间它们不会被释放；构造中或不由共享指针持有的容器无法获取，
+        // 它们持有的子数据不会被扣减引用，因而作为根保留
+        std::vector<std::shared_ptr<Traceable>> objects;
+        {
+            std::lock_guard lock(collector.mutex);
+            objects.reserve(collector.tracked.size());
+            for (const auto &object: collector.tracked) {
+                if (auto shared = object->weak_from_this().lock()) {
+                    objects.push_back(std::move(shared));
+                }
+            }
+            collector.allocations = 0;
+        }
+        constexpr auto NOT_TRACKED = static_cast<size_t>(-1);
+        std::unordered_map<const Traceable *, size_t> indices;
+        indices.reserve(objects.size());
+        std::vector<long> external_refs(objects.size());
+        for (size_t i = 0; i < objects.size(); ++i) {
+            indices.emplace(objects[i].get(), i);
+            external_refs[i] = objects[i].use_count() - 1; // 扣除 objects 自身的持有
+        }
+        const auto index_of = [&indices](const base::RVM_Data *child) -> size_t {
+            if (const auto *traceable = dynamic_cast<const Traceable *>(child)) {
+                if (const auto it = indices.find(traceable); it != indices.end()) {
+                    return it->second;
+                }
+            }
+            return NOT_TRACKED;
+        };
+        // 扣除容器之间的内部引用，剩余引用来自容器之外
+        for (const auto &object: objects) {
+            object->traceChildren([&](const base::RVM_Data *child) {
+                if (const auto index = index_of(child); index != NOT_TRACKED) {
+                    --external_refs[index];
+                }
+            });
+        }
+        std::vector<bool> reachable(objects.size(), false);
+        std::vector<size_t> pending;
+        for (size_t i = 0; i < objects.size(); ++i) {
+            if (external_refs[i] > 0) {
+                reachable[i] = true;
+                pending.push_back(i);
+            }
+        }
+        while (!pending.empty()) {
+            const auto current = pending.back();
+            pending.pop_back();
+            objects[current]->traceChildren([&](const base::RVM_Data *child) {
+                if (const auto index = index_of(child); index != NOT_TRACKED && !reachable[index]) {
+                    reachable[index] = true;
+                    pending.push_back(index);
+                }
+            });
+        }
+        size_t freed = 0;
+        for (size_t i = 0; i < objects.size(); ++i) {
+            if (!reachable[i]) {
+                objects[i]->clearChildren();
+                ++freed;
+            }
+        }
+        const auto survivors = objects.size() - freed;
+        objects.clear(); // 释放最后的持有，环垃圾在此析构
+        const auto pause_ms = std::chrono::duration<double, std::milli>(
+                std::chrono::steady_clock::now() - start_time).count();
+        std::lock_guard lock(collector.mutex);
+        collector.next_trigger = survivors;
+        ++collector.stats.collections;
+        collector.stats.freed += freed;
+        collector.stats.total_pause_ms += pause_ms;
+        collector.stats.max_pause_ms = std::max(collector.stats.max_pause_ms, pause_ms);
+        return freed;
+    }
 
-    RVM_Scope::RVM_Scope(std::string name): name_(std::move(name)) {}
+    size_t CycleCollector::getTrackedCount() {
+        auto &collector = state();
+        std::lock_guard lock(collector.mutex);
+        return collector.tracked.size();
+    }
+
+    CycleCollector::Stats CycleCollector::getStats() {
+        auto &collector = state();
+        std::lock_guard lock(collector.mutex);
+        return collector.stats;
+    }
+
+    void CycleCollector::printInfo(std::ostream &out) {
+        const auto stats = getStats();
+        out << "\n=== CycleCollector Information ===\n";
+        out << "Threshold: " << threshold << "\n";
+        out << "Tracked: " << getTrackedCount() << "\n";
+        out << "Collections: " << stats.collections << "\n";
+        out << "Freed: " << stats.freed << "\n";
+        out << "Total Pause: " << stats.total_pause_ms << " ms\n";
+        out << "Max Pause: " << stats.max_pause_ms << " ms\n";
+        out << "=== End of CycleCollector Information ===\n";
+    }
+
+    int HeapQuota::soft_limit_mb = 0;
+    int HeapQuota::hard_limit_mb = 0;
+
+    namespace {
+        constexpr size_t BYTES_PER_MB = 1024 * 1024;
+
+        std::string formatBytes(const size_t bytes) {
+            std::ostringstream oss;
+            oss << std::fixed << std::setprecision(2)
+                << static_cast<double>(bytes) / BYTES_PER_MB << " MB (" << bytes << " bytes)";
+            return oss.str();
+        }
+    }
+
+    void HeapQuota::start() {
+        resetTrigger(getUsage());
+    }
+
+    void HeapQuota::adjust(State &state, const HeapCategory category, const size_t old_bytes, const size_t new_bytes) {
+        auto &category_usage = state.category_usage[static_cast<size_t>(category)];
+        if (new_bytes < old_bytes) {
+            state.usage.fetch_sub(old_bytes - new_bytes, std::memory_order_relaxed);
+            category_usage.fetch_sub(old_bytes - new_bytes, std::memory_order_relaxed);
+            return;
+        }
+        const auto usage = state.usage.fetch_add(new_bytes - old_bytes, std::memory_order_relaxed) + new_bytes - old_bytes;
+        category_usage.fetch_add(new_bytes - old_bytes, std::memory_order_relaxed);
+        for (auto peak = state.peak.load(std::memory_order_relaxed);
+             usage > peak && !state.peak.compare_exchange_weak(peak, usage, std::memory_order_relaxed);) {}
+        if (usage >= state.trigger.load(std::memory_order_relaxed)) {
+            state.pressure.store(true, std::memory_order_relaxed);
+        }
+    }
+
+    bool HeapQuota::relieve() {
+        CycleCollector::collect();
+        const auto usage = getUsage();
+        const auto hard_limit = static_cast<size_t>(hard_limit_mb) * BYTES_PER_MB;
+        if (hard_limit_mb > 0 && usage > hard_limit) {
+            // 留出余量，使捕获错误的代码得以运行并释放数据，用量继续增长时再次报错
+            current().trigger.store(usage + hard_limit / 8, std::memory_order_relaxed);
+            current().pressure.store(false, std::memory_order_relaxed);
+            return false;
+        }
+        resetTrigger(usage);
+        return true;
+    }
+
+    void HeapQuota::resetTrigger(const size_t usage) {
+        const auto soft_limit = static_cast<size_t>(soft_limit_mb) * BYTES_PER_MB;
+        const auto hard_limit = static_cast<size_t>(hard_limit_mb) * BYTES_PER_MB;
+        size_t trigger = NO_TRIGGER;
+        if (soft_limit_mb > 0 && usage < soft_limit) {
+            trigger = soft_limit;
+        } else if (hard_limit_mb > 0) {
+            trigger = hard_limit;
+        } else if (soft_limit_mb > 0) {
+            // 只设置软上限时，超出后每当用量翻倍回收一次
+            trigger = usage * 2;
+        }
+        current().trigger.store(trigger, std::memory_order_relaxed);
+        current().pressure.store(usage >= trigger, std::memory_order_relaxed);
+    }
+
+    std::vector<std::string> HeapQuota::getReport() {
+        static const char *category_names[CATEGORY_COUNT] = {"String", "List", "Dict", "CustomInst"};
+        std::vector<std::string> report{
+            "This error is caused by the data of the program exceeding the heap limit.",
+            "Heap Usage: " + formatBytes(getUsage()),
+            "Heap Limit: " + formatBytes(static_cast<size_t>(hard_limit_mb) * BYTES_PER_MB),
+            "Peak Usage: " + formatBytes(getPeak()),
+            "Tracked Containers: " + std::to_string(CycleCollector::getTrackedCount())
+        };
+        for (size_t i = 0; i < CATEGORY_COUNT; ++i) {
+            report.push_back(std::string(category_names[i]) + " Payload: " +
+                             formatBytes(current().category_usage[i].load(std::memory_order_relaxed)));
+        }
+        return report;
+    }
+
+    void HeapQuota::printInfo(std::ostream &out) {
+        out << "\n=== HeapQuota Information ===\n";
+        out << "Soft Limit: " << soft_limit_mb << " MB\n";
+        out << "Hard Limit: " << hard_limit_mb << " MB\n";
+        out << "Usage: " << formatBytes(getUsage()) << "\n";
+        out << "Peak: " << formatBytes(getPeak()) << "\n";
+        out << "=== End of HeapQuota Information ===\n";
+    }
+
+    HeapAccount::HeapAccount(const HeapCategory category): quota_(&HeapQuota::current()), category_(category) {}
+
+    HeapAccount::HeapAccount(const HeapAccount &other): quota_(&HeapQuota::current()), category_(other.category_) {}
+
+    HeapAccount &HeapAccount::operator=(const HeapAccount &) {
+        // 记账属于对象本身的载荷，由赋值后的 recharge 更新
+        return *this;
+    }
+
+    HeapAccount::~HeapAccount() {
+        HeapQuota::adjust(*quota_, category_, charged_bytes_, 0);
+    }
+
+    void HeapAccount::recharge() {
+        if (const auto bytes = payloadBytes(); bytes != charged_bytes_) {
+            HeapQuota::adjust(*quota_, category_, charged_bytes_, bytes);
+            charged_bytes_ = bytes;
+        }
+    }
+
+    RVM_Scope::RVM_Scope(std::string name): registry_(&base::ThreadBound<Registry>::current()), name_(std::move(name)) {
+        auto &scopes = registry_->entries;
+        // 优先复用已销毁作用域的编号，避免作用域池反复裁剪与创建时耗尽编号
+        if (auto &ids = registry_->free_ids; !ids.empty()) {
+            id_ = ids.back();
+            ids.pop_back();
+            next_generation_ = scopes[id_].next_generation;
+        } else {
+            id_ = static_cast<uint32_t>(scopes.size());
+            if (id_ > id::DataID::MAX_SCOPE_ID) {
+                throw std::runtime_error("The number of scopes exceeds the limit of data identities.");
+            }
+            scopes.emplace_back();
+        }
+        scopes[id_].scope = this;
+    }
 
     RVM_Scope::RVM_Scope(std::string name, const std::unordered_map<std::string, std::shared_ptr<base::RVM_Data>> &dataMap)
-        : name_(std::move(name)) {
-        nameMap.reserve(dataMap.size());
-        this->dataMap.reserve(dataMap.size());
+        : RVM_Scope(std::move(name)) {
+        slots_.reserve(dataMap.size());
         for (const auto& [key, value] : dataMap) {
-            const auto dataId = id::DataID(key, name_);
-            nameMap.emplace(key, dataId);
-            this->dataMap.emplace(dataId.idstring, std::move(value));
+            const auto &_ = addData(utils::SymbolTable::intern(key), value);
         }
     }
 
+    RVM_Scope::~RVM_Scope() {
+        registry_->entries[id_] = {nullptr, next_generation_};
+        registry_->free_ids.push_back(id_);
+    }
+
+    RVM_Scope *RVM_Scope::findById(const uint32_t scope_id) noexcept {
+        const auto &scopes = base::ThreadBound<Registry>::current().entries;
+        return scope_id < scopes.size() ? scopes[scope_id].scope : nullptr;
+    }
+
+    uint32_t RVM_Scope::getId() const noexcept {
+        return id_;
+    }
+
     const std::string &RVM_Scope::getName() const noexcept {
         return name_;
     }
@@ -2553,71 +2975,198 @@ namespace core::memory{
         name_ = std::move(name);
     }
 
-    bool RVM_Scope::contains(const std::string &name) const noexcept {
-        return nameMap.contains(name);
+    size_t RVM_Scope::SlotIndex::bucketOf(const utils::Symbol symbol) const noexcept {
+        // Fibonacci 散列，使连续的符号编号分散到各个桶
+        return static_cast<size_t>((symbol * 0x9E3779B97F4A7C15ull) >> 32) & (buckets_.size() - 1);
     }
 
-    void RVM_Scope::addDataByName(const std::string &name, const std::shared_ptr<base::RVM_Data> &data) {
-        checkOpPermission(base::OpMode::Add);
-        auto id = id::DataID{name, name_};
-        if (auto [it, inserted] = dataMap.try_emplace(id.idstring, data); inserted) {
-            nameMap[name] = id;
-        } else {
-            throw base::errors::DuplicateKeyError(unknown_, unknown_,
-                                                  {"Duplicate key: [" + name + "]"},
-                                                  {"Change duplicate key names."});
+    uint32_t RVM_Scope::SlotIndex::find(const utils::Symbol symbol) const noexcept {
+        if (size_ == 0) {
+            return NO_SLOT;
+        }
+        const size_t mask = buckets_.size() - 1;
+        for (size_t i = bucketOf(symbol); ; i = (i + 1) & mask) {
+            const auto &bucket = buckets_[i];
+            if (bucket.symbol == symbol) {
+                return bucket.slot;
+            }
+            if (bucket.symbol == utils::SymbolTable::NO_SYMBOL) {
+                return NO_SLOT;
+            }
         }
     }
 
-    void RVM_Scope::addDataByID(const id::DataID &dataId, const std::shared_ptr<base::RVM_Data> &data) {
-        checkOpPermission(base::OpMode::Add);
-        if (!dataId.getScopeName().empty() && dataId.getScopeName() != name_) {
-            throw base::RVM_Error(base::ErrorType::IDError, unknown_, unknown_,
-                                  {"This error is caused by a mismatch in the scope name of the data ID used.",
-                                   "Error ID: " + dataId.idstring,
-                                   "Scope name: " + name_},
-                                  {"Check whether the scope of the data is currently valid."});
-        }
-        if (auto [it, inserted] = dataMap.try_emplace(dataId.idstring, data); inserted) {
-            nameMap[dataId.getName()] = dataId;
-        } else {
-            throw base::errors::DuplicateKeyError(unknown_, unknown_,
-                                                  {"Duplicate key: [" + dataId.idstring + "]"},
-                                                  {"Change duplicate key names."});
+    void RVM_Scope::SlotIndex::insert(const utils::Symbol symbol, const uint32_t slot) {
+        if (buckets_.empty()) {
+            buckets_.resize(INITIAL_CAPACITY);
+        } else if ((size_ + 1) * 4 > buckets_.size() * 3) {
+            rehash(buckets_.size() * 2);
+        }
+        const size_t mask = buckets_.size() - 1;
+        for (size_t i = bucketOf(symbol); ; i = (i + 1) & mask) {
+            auto &bucket = buckets_[i];
+            if (bucket.symbol == symbol) {
+                bucket.slot = slot;
+                return;
+            }
+            if (bucket.symbol == utils::SymbolTable::NO_SYMBOL) {
+                bucket = {symbol, slot};
+                ++size_;
+                return;
+            }
         }
     }
 
-    std::shared_ptr<base::RVM_Data> RVM_Scope::findDataByIdString(const std::string &idString) const {
-        if (const auto &it = dataMap.find(idString); it != dataMap.end()) {
-            return it->second;
+    void RVM_Scope::SlotIndex::erase(const utils::Symbol symbol) noexcept {
+        if (size_ == 0) {
+            return;
         }
-        return nullptr;
+        const size_t mask = buckets_.size() - 1;
+        size_t hole = bucketOf(symbol);
+        while (buckets_[hole].symbol != symbol) {
+            if (buckets_[hole].symbol == utils::SymbolTable::NO_SYMBOL) {
+                return;
+            }
+            hole = (hole + 1) & mask;
+        }
+        // 将探测链上可前移的元素移入空位，保持查找时遇到空桶即可终止
+        for (size_t i = (hole + 1) & mask; buckets_[i].symbol != utils::SymbolTable::NO_SYMBOL; i = (i + 1) & mask) {
+            const size_t home = bucketOf(buckets_[i].symbol);
+            if (((i - home) & mask) >= ((i - hole) & mask)) {
+                buckets_[hole] = buckets_[i];
+                hole = i;
+            }
+        }
+        buckets_[hole] = {};
+        --size_;
+    }
+
+    void RVM_Scope::SlotIndex::clear() noexcept {
+        if (size_ > 0) {
+            std::ranges::fill(buckets_, Bucket{});
+            size_ = 0;
+        }
+    }
+
+    void RVM_Scope::SlotIndex::fit(const size_t count) {
+        if (size_ > 0) {
+            return;
+        }
+        size_t needed = INITIAL_CAPACITY;
+        while (count * 4 > needed * 3) {
+            needed *= 2;
+        }
+        if (buckets_.size() < needed || buckets_.size() > needed * 4) {
+            std::vector<Bucket>(needed).swap(buckets_);
+        }
+    }
+
+    void RVM_Scope::SlotIndex::rehash(const size_t capacity) {
+        auto old_buckets = std::move(buckets_);
+        buckets_.assign(capacity, Bucket{});
+        size_ = 0;
+        for (const auto &bucket : old_buckets) {
+            if (bucket.symbol != utils::SymbolTable::NO_SYMBOL) {
+                insert(bucket.symbol, bucket.slot);
+            }
+        }
+    }
+
+    const RVM_Scope::Slot *RVM_Scope::resolveSlot(const id::DataID &dataId) const noexcept {
+        if (dataId.getScopeId() != id_ || dataId.getSlot() >= slots_.size()) {
+            return nullptr;
+        }
+        const auto &slot = slots_[dataId.getSlot()];
+        if (slot.symbol == utils::SymbolTable::NO_SYMBOL || slot.generation != dataId.getGeneration()) {
+            return nullptr;
+        }
+        return &slot;
+    }
+
+    void RVM_Scope::releaseSlot(const uint32_t slot) {
+        auto &released = slots_[slot];
+        index_.erase(released.symbol);
+        released = {};
+        free_slots_.push_back(slot);
+        ++epoch_;
+    }
+
+    id::DataID RVM_Scope::makeDataID(const uint32_t slot) const {
+        return id::DataID{slots_[slot].symbol, id_, slot, slots_[slot].generation};
+    }
+
+    bool RVM_Scope::contains(const std::string &name) const noexcept {
+        return contains(utils::SymbolTable::intern(name));
+    }
+
+    bool RVM_Scope::contains(const utils::Symbol symbol) const noexcept {
+        return index_.find(symbol) != SlotIndex::NO_SLOT;
+    }
+
+    void RVM_Scope::addDataByName(const std::string &name, const std::shared_ptr<base::RVM_Data> &data) {
+        const auto &_ = addData(utils::SymbolTable::intern(name), data);
+    }
+
+    id::DataID RVM_Scope::addData(const utils::Symbol symbol, const std::shared_ptr<base::RVM_Data> &data) {
+        checkOpPermission(base::OpMode::Add);
+        uint32_t slot = index_.find(symbol);
+        if (slot == SlotIndex::NO_SLOT) {
+            if (!free_slots_.empty()) {
+                slot = free_slots_.back();
+                free_slots_.pop_back();
+            } else {
+                if (slots_.size() > id::DataID::MAX_SLOT) {
+                    throw base::errors::MemoryError(unknown_, unknown_,
+                                                    {"The number of data in scope [" + name_ +
+                                                     "] exceeds the limit of data identities."},
+                                                    {"Reduce the number of variables defined in the same scope."});
+                }
+                slot = static_cast<uint32_t>(slots_.size());
+                slots_.emplace_back();
+            }
+            index_.insert(symbol, slot);
+        }
+        slots_[slot] = {data, symbol, next_generation_++ & id::DataID::GENERATION_MASK};
+        ++epoch_;
+        return makeDataID(slot);
     }
 
     std::shared_ptr<base::RVM_Data> RVM_Scope::findDataByName(const std::string &name) const {
-        if (const auto &nameIt = nameMap.find(name); nameIt != nameMap.end()){
-            return findDataByIdString(nameIt->second.idstring);
+        return findDataByName(utils::SymbolTable::intern(name));
+    }
+
+    std::shared_ptr<base::RVM_Data> RVM_Scope::findDataByName(const utils::Symbol symbol) const {
+        if (const auto slot = index_.find(symbol); slot != SlotIndex::NO_SLOT){
+            return slots_[slot].data;
         }
         return nullptr;
     }
 
     std::pair<std::optional<id::DataID>, std::shared_ptr<base::RVM_Data>>
     RVM_Scope::findDataInfoByName(const std::string &name) const {
-        if (const auto &nameIt = nameMap.find(name); nameIt != nameMap.end()){
-            return {nameIt->second, findDataByIdString(nameIt->second.idstring)};
+        return findDataInfoByName(utils::SymbolTable::intern(name));
+    }
+
+    std::pair<std::optional<id::DataID>, std::shared_ptr<base::RVM_Data>>
+    RVM_Scope::findDataInfoByName(const utils::Symbol symbol) const {
+        if (const auto slot = index_.find(symbol); slot != SlotIndex::NO_SLOT){
+            return {makeDataID(slot), slots_[slot].data};
         }
         return {std::nullopt, nullptr};
     }
 
     std::shared_ptr<base::RVM_Data> RVM_Scope::findDataByID(const id::DataID &varId) const {
-        return findDataByIdString(varId.idstring);
+        const auto slot = resolveSlot(varId);
+        return slot ? slot->data : nullptr;
     }
 
     bool RVM_Scope::updateDataByID(const id::DataID &id, const std::shared_ptr<base::RVM_Data>& newData) {
         checkOpPermission(base::OpMode::Update);
-        if (auto it = dataMap.find(id.idstring); it != dataMap.end()) {
-            if (!it->second->updateData(newData)){
-                it->second = newData;
+        if (const auto slot = resolveSlot(id)) {
+            auto &data = slots_[id.getSlot()].data;
+            if (!data->updateData(newData)){
+                data = newData;
+                ++epoch_;
             }
             return true;
         }
@@ -2625,25 +3174,37 @@ namespace core::memory{
     }
 
     bool RVM_Scope::updateDataByName(const std::string &name, std::shared_ptr<base::RVM_Data> newData) noexcept {
+        return updateDataByName(utils::SymbolTable::intern(name), std::move(newData));
+    }
+
+    bool RVM_Scope::updateDataByName(const utils::Symbol symbol, std::shared_ptr<base::RVM_Data> newData) noexcept {
         checkOpPermission(base::OpMode::Update);
-        if (auto it = nameMap.find(name); it != nameMap.end()){
-            return updateDataByID(it->second, std::move(newData));
+        if (const auto slot = index_.find(symbol); slot != SlotIndex::NO_SLOT){
+            auto &data = slots_[slot].data;
+            if (!data->updateData(newData)){
+                data = std::move(newData);
+                ++epoch_;
+            }
+            return true;
         }
         return false;
     }
 
     std::optional<id::DataID> RVM_Scope::getDataIDByName(const std::string &name) const {
-        if (const auto &it = nameMap.find(name); it != nameMap.end()){
-            return {it->second};
+        return getDataIDByName(utils::SymbolTable::intern(name));
+    }
+
+    std::optional<id::DataID> RVM_Scope::getDataIDByName(const utils::Symbol symbol) const {
+        if (const auto slot = index_.find(symbol); slot != SlotIndex::NO_SLOT){
+            return {makeDataID(slot)};
         }
         return {std::nullopt}; // Fixme: 可能有bug
     }
 
     bool RVM_Scope::removeDataByID(const id::DataID &dataId) {
         checkOpPermission(base::OpMode::Remove);
-        const auto &fullId = dataId.idstring;
-        if (dataMap.erase(fullId) > 0) {
-            nameMap.erase(dataId.getName());
+        if (resolveSlot(dataId)) {
+            releaseSlot(dataId.getSlot());
             return true;
         }
         return false;
@@ -2651,41 +3212,31 @@ namespace core::memory{
 
     bool RVM_Scope::removeDataByName(const std::string &name) {
         checkOpPermission(base::OpMode::Remove);
-        if (const auto &it = nameMap.find(name); it != nameMap.end()){
-            return removeDataByID(it->second);
+        if (const auto slot = index_.find(utils::SymbolTable::intern(name)); slot != SlotIndex::NO_SLOT){
+            releaseSlot(slot);
+            return true;
         }
         return false;
     }
 
-    void RVM_Scope::collectSelf() {
-        for (auto it = dataMap.begin(); it != dataMap.end(); ) {
-            if (it->second.use_count() == 1) {
-                nameMap.erase(it->first);
-                it = dataMap.erase(it);
-            } else {
-                ++it;
-            }
-        }
-    }
-
-    bool RVM_Scope::thisNeedCollect() const {
-        return needCollect;
-    }
-
     void RVM_Scope::printInfo() const {
         auto &out = *base::RVM_IO::getInstance();
         out << "Space Name: " << (name_.empty() ? "<unnamed>" : name_) << "\n";
-        out << "Data Count: " << dataMap.size() << "\n";
+        out << "Data Count: " << size() << "\n";
         out << "Addable: " << (addable ? "Y" : "N") << ", " <<
         "Deletable: " << (deletable ? "Y" : "N") << ", "
         << "Updatable: " << (updatable ? "Y" : "N") << "\n";
         out << "Findable: " << (findable ? "Y" : "N") << ", ";
         out << "Removable: " << (removable ? "Y" : "N") << "\n";
 
-        if (!dataMap.empty()) {
+        if (!empty()) {
             out << "Contents:\n";
-            for (const auto &[id, data]: dataMap) {
-                out << "    " << id << ": ";
+            for (uint32_t slot = 0; slot < slots_.size(); ++slot) {
+                if (slots_[slot].symbol == utils::SymbolTable::NO_SYMBOL) {
+                    continue;
+                }
+                const auto &data = slots_[slot].data;
+                out << "    " << makeDataID(slot).getIdString() << ": ";
                 if (data) {
                     out << data->getDataInfo();
                 } else {
@@ -2697,13 +3248,49 @@ namespace core::memory{
         out << "---\n";
     }
 
-    size_t RVM_Scope::size() const noexcept { return dataMap.size(); }
+    size_t RVM_Scope::size() const noexcept { return index_.size(); }
 
-    bool RVM_Scope::empty() const noexcept { return dataMap.empty(); }
+    bool RVM_Scope::empty() const noexcept { return index_.size() == 0; }
 
     void RVM_Scope::clear() noexcept {
-        dataMap.clear();
-        nameMap.clear();
+        slots_.clear();
+        free_slots_.clear();
+        index_.clear();
+        ++epoch_;
+    }
+
+    void RVM_Scope::fitCapacity(const size_t expected) {
+        if (!slots_.empty()) {
+            return;
+        }
+        if (slots_.capacity() < expected) {
+            slots_.reserve(expected);
+        } else if (slots_.capacity() > std::max<size_t>(expected, 1) * 4) {
+            std::vector<Slot> fitted;
+            fitted.reserve(expected);
+            slots_.swap(fitted);
+            std::vector<uint32_t>().swap(free_slots_);
+        }
+        index_.fit(expected);
+    }
+
+    size_t RVM_Scope::getEpoch() const noexcept { return epoch_; }
+
+    size_t RVM_Scope::getFrameIndex() const noexcept { return frame_index_; }
+
+    size_t RVM_Scope::getActivation() const noexcept { return activation_; }
+
+    size_t RVM_Scope::fingerprint() const {
+        // 按元素异或合并，与槽位顺序无关
+        size_t result = size();
+        for (const auto &[data, symbol, generation]: slots_) {
+            if (symbol == utils::SymbolTable::NO_SYMBOL) {
+                continue;
+            }
+            const size_t value_hash = data ? std::hash<std::string>{}(data->getValStr()) : 0;
+            result ^= std::hash<uint64_t>{}(static_cast<uint64_t>(symbol) << 32 | generation) * 31 + value_hash;
+        }
+        return result;
     }
 
     base::InstID RVM_Scope::getInstID() const { return instID; }
@@ -2800,11 +3387,6 @@ namespace core::memory{
         }
     }
 
-    RVM_Memory &core::memory::RVM_Memory::getInstance() {
-        static RVM_Memory instance;
-        return instance;
-    }
-
     RVM_Memory::ScopePtr
     RVM_Memory::acquireScope(const std::string &prefix, const std::string &scopeName) {
         std::lock_guard<std::mutex> lock(mutex_);
@@ -2823,9 +3405,9 @@ namespace core::memory{
     }
 
     RVM_Memory::ScopePtr
-    RVM_Memory::findOperableScopeByDataName(const std::string &name, bool needContains, const base::OpMode &opMode) const {
+    RVM_Memory::findOperableScopeByDataName(const utils::Symbol symbol, bool needContains, const base::OpMode &opMode) const {
         for (auto it = activeScopes_.rbegin(); it != activeScopes_.rend(); ++it) {
-            if ((*it)->getOpPermission(opMode) && needContains == (*it)->contains(name)){
+            if ((*it)->getOpPermission(opMode) && needContains == (*it)->contains(symbol)){
                 return *it;
             }
         }
@@ -2835,27 +3417,24 @@ namespace core::memory{
     RVM_Memory::DataPair RVM_Memory::addData(const std::string &name, const RVM_Memory::DataPtr &data, const std::string &scopeName) const
     {
         std::lock_guard lock(mutex_);
+        const auto symbol = utils::SymbolTable::intern(name);
         ScopePtr scope = scopeName.empty() ? getCurrentScopeNoLock() : findScopeByNameNoLock(scopeName);
         if (scopeName.empty() && (!scope || scope && !scope->isModifiable())){
-            scope = findOperableScopeByDataName(name, false, base::OpMode::Add);
+            scope = findOperableScopeByDataName(symbol, false, base::OpMode::Add);
         }
         if (!scope) {
             throw std::runtime_error("No valid scope available");
         }
-        if (scope->contains(name)){
+        if (scope->contains(symbol)){
             throw base::errors::DuplicateKeyError(unknown_, unknown_, {}, {});
         }
-        id::DataID dataId(name, scope->getName());
-        scope->addDataByID(dataId, data);
-        return {dataId, data};
+        return {scope->addData(symbol, data), data};
     }
 
     RVM_Memory::DataPair RVM_Memory::addGlobalData(const std::string &name, const RVM_Memory::DataPtr &data) const
     {
-        if (!globalScope_->contains(name)){
-            id::DataID dataId(name, globalScope_->getName());
-            globalScope_->addDataByID(dataId, data);
-            return {dataId, data};
+        if (const auto symbol = utils::SymbolTable::intern(name); !globalScope_->contains(symbol)){
+            return {globalScope_->addData(symbol, data), data};
         }
         throw base::errors::DuplicateKeyError(unknown_, unknown_, {}, {});
     }
@@ -2932,13 +3511,22 @@ namespace core::memory{
         return freeScopes_.size();
     }
 
+    RVM_Memory::PoolStats RVM_Memory::getPoolStats() const {
+        std::lock_guard lock(mutex_);
+        return poolStats_;
+    }
+
     void RVM_Memory::printPoolInfo() {
         std::lock_guard lock(mutex_);
         auto &out = *base::RVM_IO::getInstance();
         out << "\n=== Space Pool Information ===\n";
         out << "Active Spaces: " << activeScopes_.size() << "\n";
         out << "Free Spaces: " << freeScopes_.size() << "\n";
-        out << "Named Spaces: " << namedScopes_.size() << "\n\n";
+        out << "Named Spaces: " << namedScopes_.size() << "\n";
+        out << "High Watermark: " << watermark_ << " (Peak: " << poolStats_.peak_active << ")\n";
+        out << "Created: " << poolStats_.created << ", Reused: " << poolStats_.reused
+            << ", Trimmed: " << poolStats_.trimmed << "\n";
+        out << "Population Hints: " << populationHints_.size() << "\n\n";
 
         out << "--- Active Spaces Details ---\n";
         for (const auto &space: activeScopes_) {
@@ -2957,32 +3545,43 @@ namespace core::memory{
         }
 
         out << "\n--- Extension details ---\n";
-        for (const auto& ext : loadedExtensions | std::views::values) {
+        for (const auto& ext : loaded_extensions | std::views::values) {
             out << ext->toString() << "\n";
             out << "Path: " << ext->extension_path << "\n";
             ext->extension_scope->printInfo();
         }
 
         out << "\n--- Recent Access Cache ---\n";
+        size_t cacheEntries = 0;
         size_t validCache = 0;
-        for (const auto& [fst, snd] : recentAccessCache_ | std::views::values) {
-            if (snd.lock()) {
-                validCache++;
+        for (const auto &entries : recentAccessCache_ | std::views::values) {
+            cacheEntries += entries.size();
+            for (const auto &entry : entries | std::views::values) {
+                if (getValidCacheData(entry)) {
+                    validCache++;
+                }
             }
         }
-        out << "Cache Entries: " << recentAccessCache_.size()
+        out << "Cache Entries: " << cacheEntries
             << " (Valid: " << validCache << ")\n";
 
         out << "\n=== End of Pool Information ===\n\n<< ";
     }
 
     RVM_Memory::ScopePtr RVM_Memory::acquireScopeNoLock(const std::string &name, bool unnamed) {
+        ScopePtr scope;
         if (freeScopes_.empty()) {
-            expandPool();
+            scope = std::make_shared<RVM_Scope>();
+            ++poolStats_.created;
+        } else {
+            scope = std::move(freeScopes_.back());
+            freeScopes_.pop_back();
+            ++poolStats_.reused;
         }
-
-        auto scope = std::move(freeScopes_.front());
-        freeScopes_.pop();
+        // 按同名作用域以往的数据数量预分配容量，容量远超所需时收缩
+        auto &hint = populationHints_[name];
+        scope->fitCapacity(hint);
+        scope->population_hint_ = &hint;
 
         const std::string &spaceName = unnamed ?
                                        DEFAULT_SCOPE_PREFIX + name + "#" + std::to_string(nextDefaultNameId_++) :
@@ -2990,24 +3589,82 @@ namespace core::memory{
 
         scope->setName(spaceName);
         namedScopes_[spaceName] = scope;
-        activeScopes_.push_back(scope);
+        pushScopeFrameNoLock(scope);
         currentScope_ = scope;
+        watermark_ = std::max(watermark_, activeScopes_.size());
+        poolStats_.peak_active = std::max(poolStats_.peak_active, activeScopes_.size());
         return scope;
     }
 
+    void RVM_Memory::pushScopeFrameNoLock(const RVM_Memory::ScopePtr &scope) {
+        scope->frame_index_ = activeScopes_.size();
+        ++scope->activation_;
+        activeScopes_.push_back(scope);
+    }
+
+    void RVM_Memory::popScopeFrameNoLock(const RVM_Memory::ScopePtr &scope) {
+        const size_t index = scope->frame_index_;
+        if (index >= activeScopes_.size() || activeScopes_[index] != scope) {
+            return;
+        }
+        if (index + 1 == activeScopes_.size()) {
+            activeScopes_.pop_back();
+        } else {
+            activeScopes_.erase(activeScopes_.begin() + static_cast<std::ptrdiff_t>(index));
+            for (size_t i = index; i < activeScopes_.size(); ++i) {
+                activeScopes_[i]->frame_index_ = i;
+            }
+        }
+        scope->frame_index_ = RVM_Scope::NO_FRAME;
+        // 以该作用域为当前作用域的缓存随之失效；数据位于该作用域的缓存项由激活序号判定失效
+        recentAccessCache_.erase(scope.get());
+    }
+
+    const utils::Symbol RVM_Memory::DISCARD_SYMBOL = utils::SymbolTable::intern("_");
+
+    RVM_Memory::DataPtr RVM_Memory::getValidCacheData(const AccessCacheEntry &entry) {
+        if (entry.scope->frame_index_ == RVM_Scope::NO_FRAME || entry.scope->activation_ != entry.activation) {
+            return nullptr;
+        }
+        return entry.data.lock();
+    }
+
     void RVM_Memory::releaseScopeNoLock(const RVM_Memory::ScopePtr &scope) {
         const auto &name = scope->getName();
         if (!name.empty()) {
             namedScopes_.erase(name);
         }
-        activeScopes_.remove(scope);
-        recentAccessCache_.clear();
+        popScopeFrameNoLock(scope);
 
+        if (scope->population_hint_) {
+            // 估计值取本次数量与缓慢衰减的历史值中的较大者
+            auto &hint = *scope->population_hint_;
+            hint = std::max(scope->size(), hint - hint / 8);
+            scope->population_hint_ = nullptr;
+        }
         scope->clear();
         scope->setName("");
-        freeScopes_.push(scope);
+        freeScopes_.push_back(scope);
 
         currentScope_ = activeScopes_.empty() ? nullptr : activeScopes_.back();
+        if (++releases_since_decay_ >= POOL_DECAY_INTERVAL) {
+            trimPoolNoLock();
+        }
+    }
+
+    void RVM_Memory::trimPoolNoLock() {
+        releases_since_decay_ = 0;
+        const size_t active = activeScopes_.size();
+        watermark_ = active + (std::max(watermark_, active) - active) / 2;
+        const size_t target = std::max(INITIAL_POOL_SIZE, watermark_ - active);
+        if (freeScopes_.size() <= target) {
+            return;
+        }
+        const auto excess = static_cast<std::ptrdiff_t>(freeScopes_.size() - target);
+        // 缓存项以裸指针记录数据所在的作用域，销毁作用域前丢弃全部缓存
+        recentAccessCache_.clear();
+        freeScopes_.erase(freeScopes_.begin(), freeScopes_.begin() + excess);
+        poolStats_.trimmed += excess;
     }
 
     RVM_Memory::ScopePtr RVM_Memory::getCurrentScopeNoLock() const noexcept {
@@ -3020,70 +3677,94 @@ namespace core::memory{
     }
 
     void RVM_Memory::updateDataNoLock(const id::DataID &dataId, const RVM_Memory::DataPtr &newData) const {
-        if (dataId.getScopeName() == globalScope_->getName()){
-            globalScope_->updateDataByID(dataId, std::move(newData));
+        if (const auto scope = RVM_Scope::findById(dataId.getScopeId());
+            scope && scope->updateDataByID(dataId, newData)) {
             return;
         }
-        if (currentScope_){
-            if(currentScope_->isModifiable() &&
-            currentScope_->updateDataByID(dataId, newData)){
-                return;
-            }
-        }
-        if (const auto scope = findOperableScopeByDataName(dataId.getName(), true, base::OpMode::Update)){
-            scope->updateDataByID(dataId, std::move(newData));
+        // 标识已失效（如所在作用域已释放）但仍有同名数据时忽略本次更新
+        if (findOperableScopeByDataName(dataId.getSymbol(), true, base::OpMode::Update)){
             return;
         }
         throw base::errors::MemoryError(unknown_, unknown_, {}, {});
     }
 
     void RVM_Memory::updateDataByNameNoLock(const std::string &name, DataPtr newData) const
+    {
+        updateDataByNameNoLock(utils::SymbolTable::intern(name), std::move(newData));
+    }
+
+    void RVM_Memory::updateDataByNameNoLock(const utils::Symbol symbol, DataPtr newData) const
     {
         if (!newData) {
             throw base::errors::MemoryError(unknown_, unknown_, {}, {});
         }
-        if (name == "_") {
+        if (symbol == DISCARD_SYMBOL) {
             return;
         }
-        const auto &cache_name = name + "@" + getCurrentScopeNoLock()->getName();
-        if (auto cachedData = recentAccessCache_.find(cache_name);
-                cachedData != recentAccessCache_.end()) {
-            auto &[id, weakData] = *cachedData;
-            if (auto data = weakData.second.lock()) {
-                if (data->updateData(newData)) {
-                    return;
-                }
+        if (const auto &data = findCachedDataNoLock(symbol)) {
+            if (data->updateData(newData)) {
+                return;
             }
         }
         if (currentScope_){
-            if (currentScope_->isUpdatable() && currentScope_->contains(name)){
-                currentScope_->updateDataByName(name, std::move(newData));
+            if (currentScope_->isUpdatable() && currentScope_->contains(symbol)){
+                currentScope_->updateDataByName(symbol, std::move(newData));
                 return;
             }
         }
-        if (globalScope_->contains(name)){
-            globalScope_->updateDataByName(name, std::move(newData));
+        if (globalScope_->contains(symbol)){
+            globalScope_->updateDataByName(symbol, std::move(newData));
             return;
         }
-        auto scope = findOperableScopeByDataName(name, true, base::OpMode::Update);
-        if (scope && scope->updateDataByName(name, std::move(newData))) {
+        auto scope = findOperableScopeByDataName(symbol, true, base::OpMode::Update);
+        if (scope && scope->updateDataByName(symbol, std::move(newData))) {
             return;
         }
         throw base::errors::MemoryError(unknown_, unknown_,{},{});
     }
 
-    void RVM_Memory::removeDataNoLock(const id::DataID &varId) const
+    RVM_Memory::DataPtr RVM_Memory::findUpdateTargetNoLock(const std::string &name) const
     {
-        if (currentScope_){
-            if (currentScope_->removeDataByID(varId)) {
-                return;
-            }
+        return findUpdateTargetNoLock(utils::SymbolTable::intern(name));
+    }
+
+    RVM_Memory::DataPtr RVM_Memory::findUpdateTargetNoLock(const utils::Symbol symbol) const
+    {
+        if (symbol == utils::SymbolTable::NO_SYMBOL || symbol == DISCARD_SYMBOL) {
+            return nullptr;
         }
-        for (auto &space: activeScopes_) {
-            if (space->removeDataByID(varId)) {
-                return;
+        if (auto data = findCachedDataNoLock(symbol)) {
+            return data;
+        }
+        if (currentScope_ && currentScope_->isUpdatable() && currentScope_->contains(symbol)) {
+            return currentScope_->findDataByName(symbol);
+        }
+        if (globalScope_->contains(symbol)) {
+            return globalScope_->getOpPermission(base::OpMode::Update) ? globalScope_->findDataByName(symbol) : nullptr;
+        }
+        if (const auto &scope = findOperableScopeByDataName(symbol, true, base::OpMode::Update)) {
+            return scope->findDataByName(symbol);
+        }
+        return nullptr;
+    }
+
+    RVM_Memory::DataPtr RVM_Memory::findCachedDataNoLock(const utils::Symbol symbol) const
+    {
+        if (const auto scopeCache = recentAccessCache_.find(getCurrentScopeNoLock().get());
+                scopeCache != recentAccessCache_.end()) {
+            if (const auto cachedData = scopeCache->second.find(symbol); cachedData != scopeCache->second.end()) {
+                return getValidCacheData(cachedData->second);
             }
         }
+        return nullptr;
+    }
+
+    void RVM_Memory::removeDataNoLock(const id::DataID &varId) const
+    {
+        if (const auto scope = RVM_Scope::findById(varId.getScopeId());
+            scope && scope->removeDataByID(varId)) {
+            return;
+        }
         throw base::errors::MemoryError(unknown_, unknown_,{},{});
     }
 
@@ -3094,8 +3775,7 @@ namespace core::memory{
             }
         }
         for (auto &space: std::ranges::reverse_view(activeScopes_)) {
-            if (auto get_res = space->getDataIDByName(name); get_res.has_value()) {
-                space->removeDataByID(get_res.value());
+            if (space->removeDataByName(name)) {
                 return;
             }
         }
@@ -3109,14 +3789,13 @@ namespace core::memory{
 
         for (auto &space: activeScopes_) {
             space->clear();
+            space->frame_index_ = RVM_Scope::NO_FRAME;
         }
         activeScopes_.clear();
 
-        while (!freeScopes_.empty()) {
-            auto space = std::move(freeScopes_.front());
-            space->clear();
-            freeScopes_.pop();
-        }
+        freeScopes_.clear();
+        watermark_ = 0;
+        releases_since_decay_ = 0;
 
         namedScopes_.clear();
         recentAccessCache_.clear();
@@ -3125,9 +3804,11 @@ namespace core::memory{
     }
 
     void RVM_Memory::initializePool(size_t size) {
+        freeScopes_.reserve(freeScopes_.size() + size);
         for (size_t i = 0; i < size; ++i) {
-            freeScopes_.push(std::make_shared<RVM_Scope>());
+            freeScopes_.push_back(std::make_shared<RVM_Scope>());
         }
+        poolStats_.created += size;
     }
 
     void RVM_Memory::expandPool(size_t size) {
@@ -3135,67 +3816,43 @@ namespace core::memory{
     }
 
     RVM_Memory::DataPtr RVM_Memory::findDataByIDNoLock(const id::DataID &dataId) const {
-        if (!dataId.getScopeName().empty()) {
-            if (dataId.getScopeName() == globalScope_->getName()){
-                return globalScope_->findDataByID(dataId);
-            }
-            if (auto space = findScopeByNameNoLock(dataId.getScopeName())) {
-                return space->findDataByID(dataId);
-            }
-        }
-        if (currentScope_){
-            if (auto data = currentScope_->findDataByID(dataId)){
-                return data;
-            }
-        }
-        for (const auto &space: std::ranges::reverse_view(activeScopes_)) {
-            if (auto data = space->findDataByID(dataId)) {
-                return data;
-            }
+        // 标识中包含所在作用域的编号，直接定位，无需逐个作用域查找
+        if (const auto scope = RVM_Scope::findById(dataId.getScopeId())) {
+            return scope->findDataByID(dataId);
         }
         return nullptr;
     }
 
     RVM_Memory::DataPair RVM_Memory::findDataByNameNoLock(const std::string &name) const {
-        const auto &cache_name = name + "@" + getCurrentScopeNoLock()->getName();
-        if (auto it = recentAccessCache_.find(cache_name); it != recentAccessCache_.end()) {
-            if (auto data = it->second.second.lock()) {
-                return {it->second.first, data};
+        return findDataByNameNoLock(utils::SymbolTable::intern(name));
+    }
+
+    RVM_Memory::DataPair RVM_Memory::findDataByNameNoLock(const utils::Symbol symbol) const {
+        auto &scopeCache = recentAccessCache_[getCurrentScopeNoLock().get()];
+        if (const auto it = scopeCache.find(symbol); it != scopeCache.end()) {
+            if (auto data = getValidCacheData(it->second)) {
+                return {it->second.id, data};
             }
-            recentAccessCache_.erase(it);
+            scopeCache.erase(it);
         }
-        if (auto dataID = globalScope_->getDataIDByName(name); dataID.has_value()){
-            return {dataID.value(), globalScope_->findDataByIdString(dataID->idstring)};
+        if (auto [dataID, data] = globalScope_->findDataInfoByName(symbol); dataID.has_value()){
+            return {dataID.value(), data};
         }
         if (currentScope_){
-            if (auto dataID = currentScope_->getDataIDByName(name); dataID.has_value()) {
-                return {dataID.value(), currentScope_->findDataByIdString(dataID->idstring)};
+            if (auto [dataID, data] = currentScope_->findDataInfoByName(symbol); dataID.has_value()) {
+                return {dataID.value(), data};
             }
         }
         for (const auto &space: std::ranges::reverse_view(activeScopes_)) {
-            if (auto data = space->findDataInfoByName(name);
+            if (auto data = space->findDataInfoByName(symbol);
                     data.first.has_value() && data.second) {
                 // 更新缓存
-                recentAccessCache_[cache_name] = {data.first.value(), data.second};
+                scopeCache.insert_or_assign(symbol, AccessCacheEntry{data.first.value(), data.second,
+                                                                      space.get(), space->activation_});
                 return {data.first.value(), data.second};
             }
         }
-        return {id::DataID(name), nullptr};
-    }
-
-    void RVM_Memory::start(int intervalMs) {
-        if (running_) return;
-        running_ = true;
-        base::RVM_ThreadPool::getInstance().enqueue([this, intervalMs]() {
-            while (running_) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(intervalMs));
-                collectGarbage();
-            }
-        });
-    }
-
-    void RVM_Memory::stop() {
-        running_ = false;
+        return {id::DataID(symbol, 0, 0, 0), nullptr};
     }
 
     void RVM_Memory::setCurrentScopeByName(const std::string &scope_name) {
@@ -3209,19 +3866,16 @@ namespace core::memory{
         return globalScope_;
     }
 
-    RVM_Memory::RVM_Memory(size_t initialSize) : nextDefaultNameId_(0), running_(false) {
-        initializePool(initialSize);
+    std::vector<RVM_Memory::ScopePtr> RVM_Memory::getVisibleScopesNoLock() const {
+        std::vector<ScopePtr> scopes;
+        scopes.reserve(activeScopes_.size() + 1);
+        scopes.push_back(globalScope_);
+        scopes.insert(scopes.end(), activeScopes_.begin(), activeScopes_.end());
+        return scopes;
     }
 
-    void RVM_Memory::collectGarbage() {
-        std::lock_guard<std::mutex> lock(mutex_);
-        for (auto& space : activeScopes_) {
-            if (space->thisNeedCollect()){
-                releaseScopeNoLock(space);
-                continue;
-            }
-            space->collectSelf();
-        }
+    RVM_Memory::RVM_Memory(size_t initialSize) : nextDefaultNameId_(0) {
+        initializePool(initialSize);
     }
 
     void RVM_Memory::removeScopeNoLock(const RVM_Memory::ScopePtr &scope) {
@@ -3229,8 +3883,7 @@ namespace core::memory{
         if (!name.empty()) {
             namedScopes_.erase(name);
         }
-        activeScopes_.remove(scope);
-        recentAccessCache_.clear();
+        popScopeFrameNoLock(scope);
 
         currentScope_ = activeScopes_.empty() ? nullptr : activeScopes_.back();
     }
@@ -3254,7 +3907,7 @@ namespace core::memory{
 
     void RVM_Memory::appendScopeNoLock(const RVM_Memory::ScopePtr &space) {
         if (!space || checkScopeExistNoLock(space)) return;
-        activeScopes_.push_back(space);
+        pushScopeFrameNoLock(space);
         currentScope_ = space;
 
         if (!space->getName().empty()) {
@@ -3289,6 +3942,7 @@ namespace core::memory{
     bool RVM_Memory::checkScopeExistNoLock(const RVM_Memory::ScopePtr &space) const
     {
         if (!space) return false;
-        return namedScopes_.contains(space->getName());
+        const size_t index = space->frame_index_;
+        return index < activeScopes_.size() && activeScopes_[index] == space;
     }
 }
\ No newline at end of file
@@ -6,6 +6,7 @@
 #include <utility>
 #include <stack>
 #include <filesystem>
+#include <random>
 #include "../include/ra_parser.h"
 #include "../include/ra_base.h"
 #include "../include/ra_core.h"
@@ -13,18 +14,12 @@
 
 using namespace core;
 
-auto &loadedExtensions = memory::loadedExtensions;
-
 namespace parser {
 
-    core::memory::RVM_Memory &data_space_pool = memory::RVM_Memory::getInstance();
-    base::RVM_IO *io{base::RVM_IO::getInstance()};
-    InsSetPool &ins_set_pool = InsSetPool::getInstance();
     utils::StringManager &string_manager = utils::StringManager::getInstance();
 
     InsSetPool &InsSetPool::getInstance() {
-        static InsSetPool instance;
-        return instance;
+        return base::ThreadBound<InsSetPool>::current();
     }
 
     StdInsSet InsSetPool::acquire(const std::string &prefix) {
@@ -103,7 +98,7 @@ namespace parser {
     }
 
     namespace components {
-        StdInsSet INS_SET = ins_set_pool.acquire(pre_SRC); // 主文件指令集
+        StdInsSet INS_SET = ins_set_pool().acquire(pre_SRC); // 主文件指令集
     }
 
     // 运行环境必要函数实现
@@ -114,21 +109,24 @@ namespace parser {
 
         std::string precompiled_link_dir_path = R"(D:\ClionProjects\RVM\lib)";
 
-        bool has_initial = false;
+        int rasm_cache_capacity = 64;
+
+        bool compile_cache_option {true};
 
         void initialize(const std::string &executed_file_path, const std::string &working_directory) {
-            if (has_initial) {
-                data_space_pool.reset();
+            auto &state = ExecutionState::current();
+            if (state.initialized) {
+                data_space_pool().reset();
             }
-            has_initial = true;
-            base::PROGRAM_WORKING_DIRECTORY_STACK.push(
+            state.initialized = true;
+            base::getProgramWorkingDirectoryStack().push(
                     utils::getAbsolutePath(working_directory.empty() || working_directory == undefined_ ?
                     utils::getFileDirFromPath(executed_file_path) : working_directory));
-            auto [SR_id, _1] = data_space_pool.addGlobalData("SR", std::make_shared<data::Null>());
-            SR_SpaceID = SR_id;
-            auto [SE_id_, _2] = data_space_pool.addGlobalData("_SE", std::make_shared<data::Null>());
-            _SE_SpaceID = SE_id_;
-            data_space_pool.addGlobalDataBatch({
+            auto [SR_id, _1] = data_space_pool().addGlobalData("SR", std::make_shared<data::Null>());
+            state.sr_space_id = SR_id;
+            auto [SE_id_, _2] = data_space_pool().addGlobalData("_SE", std::make_shared<data::Null>());
+            state.se_space_id = SE_id_;
+            data_space_pool().addGlobalDataBatch({
                     {"SN", std::make_shared<data::Null>()},
                     {"SE", std::make_shared<data::Null>()},
                     {"SS", std::make_shared<data::Null>()},
@@ -150,18 +148,19 @@ namespace parser {
                     {"tp-qot", std::make_shared<data::DType>(data::Quote::typeId)}
             });
             const auto &main_space_name = utils::getFileNameFromPath(executed_file_path);
-            data_space_pool.acquireScope(pre_SRC, main_space_name);
-            data_space_pool.main_scope_name = pre_SRC + main_space_name;
+            data_space_pool().acquireScope(pre_SRC, main_space_name);
+            data_space_pool().main_scope_name = pre_SRC + main_space_name;
         }
 
         void addIns(const utils::Pos &pos, const std::string &raw_code, const RI *ri, const StdArgs &args, const std::string &ext) {
-            components::INS_SET->addIns(std::make_shared<Ins>(pos, raw_code, ri, args, ext));
+            ProgramArena::Scope arena_scope(components::INS_SET->arena());
+            components::INS_SET->addIns(ProgramArena::make<Ins>(pos, raw_code, ri, args, ext));
         }
 
         void serializeLinkedExtensions(std::ostream &out) {
-            size_t extension_count = loadedExtensions.size();
+            size_t extension_count = data_space_pool().loaded_extensions.size();
             out.write(reinterpret_cast<const char *>(&extension_count), sizeof(extension_count));
-            for (const auto& ext_name : loadedExtensions | std::views::keys) {
+            for (const auto& ext_name : data_space_pool().loaded_extensions | std::views::keys) {
                 size_t extension_size = ext_name.size();
                 out.write(reinterpret_cast<const char *>(&extension_size), sizeof(extension_size));
                 if (extension_size > 0){
@@ -181,7 +180,7 @@ namespace parser {
                     std::string extension;
                     extension.resize(extension_size);
                     in.read(&extension[0], static_cast<long long>(extension_size));
-                    loadedExtensions.emplace(extension, nullptr); // FixMe
+                    data_space_pool().loaded_extensions.emplace(extension, nullptr); // FixMe
                 }
             }
         }
@@ -274,9 +273,11 @@ namespace parser {
         parseCode(const ParseType &type, std::string code_path, std::string &code, bool output_info,
                   const std::optional<utils::Pos> &fixed_pos, const std::string &ext) {
             code_path = utils::getAbsolutePath(code_path);
+            // 每条指令连同参数约占源码长度的数倍，以此预估内存区首块的大小
+            ProgramArena::Scope arena_scope(std::max<size_t>(code.size() * 8, 1024));
             const auto &code_name = id::DataID(utils::getFileFromPath(code_path)).toFullString();
             std::stack<std::shared_ptr<InsSet>> insSetStack{};
-            insSetStack.push(ins_set_pool.acquire(pre_SRC));
+            insSetStack.push(ins_set_pool().acquire(pre_SRC));
             insSetStack.top()->setScopeLeader(
                     utils::getObjectFormatString(ParseTypeUtils::toString(type), code_name));
             insSetStack.top()->setScopeLeaderPos(
@@ -300,7 +301,7 @@ namespace parser {
                     continue;
                 }
                 std::vector<std::string> rawParameters = utils::StringManager::split(parametersStr, ',');
-                std::vector<utils::Arg> args{};
+                StdArgs args(ProgramArena::resource());
                 int paramStartColumn = static_cast<int>(indents[lineNumber - 1]) + static_cast<int>(colonPos) + 2;
                 static auto getPrefixSpaceLength = [](const std::string &content) -> size_t {
                     size_t count = 0;
@@ -353,28 +354,28 @@ namespace parser {
                                           {"Please refer to the official instruction documentation for help."});
                 }
                 const auto &ri = ri_opt;
-                auto ins_ptr = std::make_shared<Ins>(
-                        insPos, line, ri, args, ext);
+                auto ins_ptr = ProgramArena::make<Ins>(
+                        insPos, line, ri, std::move(args), ext);
                 auto &topInsSet = insSetStack.top();
                 if (ri->hasScope) {
                     topInsSet->addIns(ins_ptr);
-                    insSetStack.push(ins_ptr->scopeInsSet);
-                    insSetStack.top()->scope_prefix = ri->name + "-";
+                    insSetStack.push(ins_ptr->scopeInsSet());
+                    insSetStack.top()->scope_prefix = std::string(ri->name) + "-";
                     insSetStack.top()->is_delayed_release_scope = ri->isDelayedReleaseScope;
-                    insSetStack.top()->setScopeLeader(ins_ptr->raw_code);
+                    insSetStack.top()->setScopeLeader(ins_ptr->rawCode());
                     insSetStack.top()->setScopeLeaderPos(ins_ptr->pos);
                 } else if (instruction == "END") {
-                    if (args.size() > 1) {
+                    if (ins_ptr->args.size() > 1) {
                         std::cerr << "Error: END instruction with more than one parameter in line: "
                                   << std::to_string(lineNumber) << "\n";
                     }
-                    if (!args.empty() && args[0].getType() != utils::ArgType::identifier &&
-                        args[0].getType() != utils::ArgType::keyword) {
+                    if (!ins_ptr->args.empty() && ins_ptr->args[0].getType() != utils::ArgType::identifier &&
+                        ins_ptr->args[0].getType() != utils::ArgType::keyword) {
                         std::cerr << "Error: END instruction with non-identifier parameter in line: "
                                   << std::to_string(lineNumber) << "\n";
                     }
-                    const auto &end_label = args.empty() ? insSetStack.top()->scope_prefix + "END"
-                                                         : args[0].getValue();
+                    const auto &end_label = ins_ptr->args.empty() ? insSetStack.top()->scope_prefix + "END"
+                                                                  : ins_ptr->args[0].getValue();
                     if (insSetStack.size() > 1) {
                         topInsSet->end_pointer = static_cast<int>(topInsSet->getInsSet().size());
                         topInsSet->setLabel(topInsSet->scope_prefix + end_label + suf_END, topInsSet->end_pointer);
@@ -386,11 +387,11 @@ namespace parser {
                     }
                     ins_ptr->is_delayed_release_scope = topInsSet->is_delayed_release_scope;
                 } else if (instruction == "SET") {
-                    topInsSet->setLabel(args[0].getValue(), int(topInsSet->getInsSet().size()));
+                    topInsSet->setLabel(ins_ptr->args[0].getValue(), int(topInsSet->getInsSet().size()));
                     topInsSet->addIns(ins_ptr);
                 } else if (instruction == "LINK") {
                     try {
-                        auto linked_file_path = tools::getArgOriginData(args[0])->getValStr();
+                        auto linked_file_path = tools::getArgOriginData(ins_ptr->args[0])->getValStr();
                         const auto &[link_name, link_ext] = utils::getFileInfoFromPath(linked_file_path);
                         const auto &linked_ins_set = getLinkedInsSet(*ins_ptr.get(), true, linked_file_path);
                         if (env::precompiled_link_option && link_ext == RA_EXT) {
@@ -414,7 +415,7 @@ namespace parser {
                                                    "Only 'RA' and 'RSI' files are supported."});
                         }
                     } catch (const base::errors::ArgumentError &_) {
-                        throw base::errors::ArgumentError(ins_ptr->args[0].getPos().toString(), ins_ptr->raw_code,
+                        throw base::errors::ArgumentError(ins_ptr->args[0].getPos().toString(), ins_ptr->rawCode(),
                                                           "Error Arg: " +
                                                           utils::getSpaceFormatString(ins_ptr->args[0].getValue(),
                                                                                       tools::getArgOriginData(
@@ -430,7 +431,7 @@ namespace parser {
                 if (output_info) {
                     std::cout << "Instruction: " << instruction << " at " << insPos << std::endl;
                     std::cout << "Parameters: ";
-                    for (const utils::Arg &param: args) {
+                    for (const utils::Arg &param: ins_ptr->args) {
                         std::cout << "[" << param.getValue() << " at " << param.getPos().toString() << "] ";
                     }
                     std::cout << std::endl;
@@ -440,6 +441,7 @@ namespace parser {
             if (insSetStack.size() != 1) {
                 throw std::runtime_error("Unclosed scope.");
             }
+            insSetStack.top()->verify();
             return insSetStack.top();
         }
 
@@ -450,25 +452,46 @@ namespace parser {
                              {}, extension_name);
         }
 
+        void serializeExecutableIns(std::ostream &out, const std::shared_ptr<InsSet> &ins_set,
+                                    const utils::SerializationProfile &profile) {
+            base::rvm_serial_header.setProfile(profile);
+            base::rvm_serial_header.setVerified(ins_set->is_verified);
+            base::rvm_serial_header.setPathTable(true);
+            base::rvm_serial_header.serialize(out);
+            env::serializeLinkedExtensions(out);
+            utils::Pos::PathTable::Scope path_table_scope;
+            ins_set->serialize(out, profile);
+        }
+
         void serializeExecutableInsToBinaryFile(std::string binary_file_path,
                                                 const std::shared_ptr<InsSet> &ins_set,
                                                 const utils::SerializationProfile &profile){
             binary_file_path = utils::getAbsolutePath(binary_file_path);
             std::ofstream binary_file(binary_file_path, std::ios::binary);
-            base::rvm_serial_header.setProfile(profile);
-            base::rvm_serial_header.serialize(binary_file);
-            env::serializeLinkedExtensions(binary_file);
-            ins_set->serialize(binary_file, profile);
+            serializeExecutableIns(binary_file, ins_set, profile);
             binary_file.close();
         }
 
+        std::shared_ptr<InsSet> deserializeExecutableIns(std::istream &in, const std::string &binary_file_path,
+                                                         const utils::SerializationProfile &profile) {
+            base::rvm_serial_header.deserialize(in, profile, binary_file_path);
+            env::deserializeLinkedExtensions(in);
+            ProgramArena::Scope arena_scope(64 * 1024);
+            // 旧版本文件未使用路径表，逐个读取完整路径
+            std::optional<utils::Pos::PathTable::Scope> path_table_scope;
+            if (base::rvm_serial_header.hasPathTable()) {
+                path_table_scope.emplace();
+            }
+            auto ins_set = std::make_shared<InsSet>("File");
+            ins_set->deserialize(in, base::rvm_serial_header.getProfile());
+            ins_set->verify(base::rvm_serial_header.isVerified());
+            return ins_set;
+        }
+
         std::shared_ptr<InsSet> deserializeExecutableInsFromBinaryFile(std::string binary_file_path, const utils::SerializationProfile &profile){
             binary_file_path = utils::getAbsolutePath(binary_file_path);
             std::ifstream binary_file(binary_file_path, std::ios::binary);
-            base::rvm_serial_header.deserialize(binary_file, profile, binary_file_path);
-            env::deserializeLinkedExtensions(binary_file);
-            auto ins_set = std::make_shared<InsSet>("File");
-            ins_set->deserialize(binary_file, base::rvm_serial_header.getProfile());
+            auto ins_set = deserializeExecutableIns(binary_file, binary_file_path, profile);
             binary_file.close();
             return ins_set;
         }
@@ -479,14 +502,15 @@ namespace parser {
             }
             const auto &link_path = utils::getAbsolutePath(
                     path.empty() ? tools::getArgOriginData(link_ins.args[0])->getValStr() : path,
-                    base::PROGRAM_WORKING_DIRECTORY_STACK.top());
+                    base::getProgramWorkingDirectoryStack().top());
             const auto &link_file_type = utils::getFileExtFromPath(link_path);
+            CompileCache::recordDependency(link_path);
             if (check_exist){
                 const auto & [isExist, extPath] = tools::checkExtensionExist(link_path);
                 if (isExist) {
                     return nullptr;
                 }
-                loadedExtensions.emplace(extPath, nullptr);
+                data_space_pool().loaded_extensions.emplace(extPath, nullptr);
             }
             if (link_file_type == "ra") {
                 return parseCodeFromPath(link_path, false);
@@ -496,5 +520,274 @@ namespace parser {
             }
             throw base::errors::ArgumentError(unknown_, unknown_, unknown_, {});
         }
+
+        RasmCache &RasmCache::getInstance() {
+            return base::ThreadBound<RasmCache>::current();
+        }
+
+        std::shared_ptr<InsSet> RasmCache::acquire(const std::string &code_path, const std::string &code,
+                                                   const utils::Pos &pos) {
+            const auto &pos_str = pos.toString();
+            const size_t key = std::hash<std::string>{}(code) ^ (std::hash<std::string>{}(pos_str) * 31);
+            const auto it = index_.find(key);
+            if (it != index_.end() && it->second->code == code && it->second->pos == pos_str) {
+                ++stats_.hits;
+                entries_.splice(entries_.begin(), entries_, it->second);
+                return entries_.front().ins_set;
+            }
+            ++stats_.misses;
+            // parseCode 会在预处理时修改源码，因此解析副本
+            std::string parsed_code = code;
+            auto ins_set = parseCode(ParseType::Rasm, code_path, parsed_code, false, pos, "");
+            if (env::rasm_cache_capacity <= 0) {
+                return ins_set;
+            }
+            if (it != index_.end()) {
+                // 哈希冲突：以新源码替换旧条目
+                entries_.erase(it->second);
+                index_.erase(it);
+            }
+            entries_.push_front({key, code, pos_str, ins_set});
+            index_[key] = entries_.begin();
+            while (entries_.size() > static_cast<size_t>(env::rasm_cache_capacity)) {
+                index_.erase(entries_.back().key);
+                entries_.pop_back();
+                ++stats_.evictions;
+            }
+            return ins_set;
+        }
+
+        void RasmCache::clear() {
+            entries_.clear();
+            index_.clear();
+        }
+
+        void RasmCache::printInfo(std::ostream &out) const {
+            out << "\n=== RasmCache Information ===\n";
+            out << "Capacity: " << env::rasm_cache_capacity << "\n";
+            out << "Entries: " << entries_.size() << "\n";
+            out << "Hits: " << stats_.hits << "\n";
+            out << "Misses: " << stats_.misses << "\n";
+            out << "Evictions: " << stats_.evictions << "\n";
+            out << "=== End of RasmCache Information ===\n";
+        }
+
+        ExtensionCache &ExtensionCache::getInstance() {
+            static ExtensionCache instance;
+            return instance;
+        }
+
+        std::shared_ptr<InsSet> ExtensionCache::acquire(const std::string &extension_path, const bool scoped) {
+            std::error_code ec;
+            const auto &write_time = std::filesystem::last_write_time(extension_path, ec);
+            const long long mtime = ec ? 0 : write_time.time_since_epoch().count();
+            const uintmax_t size = ec ? 0 : std::filesystem::file_size(extension_path, ec);
+            Entry entry;
+            {
+                std::lock_guard lock(mutex_);
+                auto &entries = scoped ? scoped_entries_ : unscoped_entries_;
+                if (const auto it = entries.find(extension_path);
+                    !ec && it != entries.end() && it->second.mtime == mtime && it->second.size == size) {
+                    ++stats_.hits;
+                    entry = it->second;
+                } else {
+                    ++stats_.misses;
+                }
+            }
+            if (entry.bytes) {
+                // 反序列化出的指令集及其参数归属新的内存区，与缓存及其他扩展实例互不影响
+                std::istringstream in(*entry.bytes);
+                ProgramArena::Scope arena_scope(std::max<size_t>(entry.bytes->size(), 1024));
+                utils::Pos::PathTable::Scope path_table_scope;
+                auto ins_set = std::make_shared<InsSet>("File");
+                ins_set->deserialize(in, utils::SerializationProfile::Debug);
+                ins_set->verify(entry.verified);
+                return ins_set;
+            }
+            const size_t recorded_before = CompileCache::recordedDependencyCount();
+            auto ins_set = parseCodeFromPath(extension_path, false, scoped ? extension_path : "");
+            if (ec || CompileCache::recordedDependencyCount() != recorded_before) {
+                return ins_set;
+            }
+            std::ostringstream out;
+            {
+                utils::Pos::PathTable::Scope path_table_scope;
+                ins_set->serialize(out, utils::SerializationProfile::Debug);
+            }
+            std::lock_guard lock(mutex_);
+            (scoped ? scoped_entries_ : unscoped_entries_)[extension_path] =
+                    {mtime, size, ins_set->is_verified, std::make_shared<const std::string>(std::move(out).str())};
+            return ins_set;
+        }
+
+        void ExtensionCache::clear() {
+            std::lock_guard lock(mutex_);
+            scoped_entries_.clear();
+            unscoped_entries_.clear();
+        }
+
+        ExtensionCache::Stats ExtensionCache::getStats() const {
+            std::lock_guard lock(mutex_);
+            return stats_;
+        }
+
+        void ExtensionCache::printInfo(std::ostream &out) const {
+            std::lock_guard lock(mutex_);
+            out << "\n=== ExtensionCache Information ===\n";
+            out << "Entries: " << scoped_entries_.size() + unscoped_entries_.size() << "\n";
+            out << "Hits: " << stats_.hits << "\n";
+            out << "Misses: " << stats_.misses << "\n";
+            out << "=== End of ExtensionCache Information ===\n";
+        }
+
+        thread_local std::vector<std::string> CompileCache::recorded_paths_{};
+
+        CompileCache::Dependency CompileCache::Dependency::of(const std::string &file_path) {
+            Dependency dependency{file_path};
+            dependency.mtime = std::filesystem::last_write_time(file_path).time_since_epoch().count();
+            dependency.size = std::filesystem::file_size(file_path);
+            dependency.hash = std::hash<std::string>{}(utils::readFile(file_path));
+            return dependency;
+        }
+
+        bool CompileCache::Dependency::isUpToDate() const {
+            std::error_code ec;
+            const auto current_size = std::filesystem::file_size(path, ec);
+            if (ec || current_size != size) {
+                return false;
+            }
+            const auto current_mtime = std::filesystem::last_write_time(path, ec);
+            if (ec) {
+                return false;
+            }
+            // 修改时间变化但大小不变时比较内容哈希，避免仅被 touch 的文件使缓存失效
+            return current_mtime.time_since_epoch().count() == mtime ||
+                   std::hash<std::string>{}(utils::readFile(path)) == hash;
+        }
+
+        void CompileCache::recordDependency(const std::string &file_path) {
+            recorded_paths_.push_back(file_path);
+        }
+
+        std::string CompileCache::getCachePath(const std::string &code_file_path) {
+            const std::filesystem::path source_path(code_file_path);
+            return (source_path.parent_path() / CACHE_DIR_NAME /
+                    (source_path.filename().string() + RSI_EXT_)).string();
+        }
+
+        size_t CompileCache::getFingerprint() {
+            // 指令在 RSI 文件中以指令表下标存储，指令表或版本变化后旧缓存不再可用
+            static const size_t format_fingerprint = [] {
+                std::string layout = base::RVMSerialHeader::getRVMVersionInfo();
+                for (const auto &[ri_name, _]: ris::riTable.entries()) {
+                    layout += ri_name;
+                    layout += ',';
+                }
+                return std::hash<std::string>{}(layout);
+            }();
+            // 调试模式与普通模式运行时各自写入的缓存互不复用
+            const bool debugging = ExecutionState::current().debug_mode != DebugMode::None;
+            return debugging ? format_fingerprint ^ 0x9e3779b97f4a7c15ULL : format_fingerprint;
+        }
+
+        std::shared_ptr<InsSet> CompileCache::read(const std::string &cache_path,
+                                                   const std::string &code_file_path) {
+            std::ifstream cache_file(cache_path, std::ios::binary);
+            if (!cache_file.is_open()) {
+                return nullptr;
+            }
+            size_t fingerprint = 0, dependency_count = 0;
+            cache_file.read(reinterpret_cast<char *>(&fingerprint), sizeof(fingerprint));
+            cache_file.read(reinterpret_cast<char *>(&dependency_count), sizeof(dependency_count));
+            if (!cache_file || fingerprint != getFingerprint() || dependency_count == 0) {
+                return nullptr;
+            }
+            for (size_t i = 0; i < dependency_count; ++i) {
+                Dependency dependency;
+                size_t path_length = 0;
+                cache_file.read(reinterpret_cast<char *>(&path_length), sizeof(path_length));
+                if (!cache_file || path_length > MAX_PATH_LENGTH) {
+                    return nullptr;
+                }
+                dependency.path.resize(path_length);
+                cache_file.read(dependency.path.data(), static_cast<long long>(path_length));
+                cache_file.read(reinterpret_cast<char *>(&dependency.mtime), sizeof(dependency.mtime));
+                cache_file.read(reinterpret_cast<char *>(&dependency.size), sizeof(dependency.size));
+                cache_file.read(reinterpret_cast<char *>(&dependency.hash), sizeof(dependency.hash));
+                if (!cache_file || (i == 0 && dependency.path != code_file_path) || !dependency.isUpToDate()) {
+                    return nullptr;
+                }
+            }
+            // 命中时沿用缓存文件头中的已校验标记：仅跳过语法结构与跳转标签的检查，参数数量与类型仍会检查
+            return deserializeExecutableIns(cache_file, cache_path, utils::SerializationProfile::Debug);
+        }
+
+        void CompileCache::write(const std::string &cache_path, const std::shared_ptr<InsSet> &ins_set,
+                                 const std::vector<Dependency> &dependencies) {
+            const std::filesystem::path target_path(cache_path);
+            std::filesystem::create_directories(target_path.parent_path());
+            // 先写入临时文件再替换，避免并发运行时读到不完整的缓存；
+            // 临时文件名带随机后缀，不同进程中同一线程标识的写入也不会冲突
+            auto temp_path = target_path;
+            std::random_device random;
+            temp_path += ".tmp" + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id())) + "-" +
+                         std::to_string((static_cast<uint64_t>(random()) << 32) | random());
+            {
+                std::ofstream cache_file(temp_path, std::ios::binary);
+                const size_t fingerprint = getFingerprint();
+                const size_t dependency_count = dependencies.size();
+                cache_file.write(reinterpret_cast<const char *>(&fingerprint), sizeof(fingerprint));
+                cache_file.write(reinterpret_cast<const char *>(&dependency_count), sizeof(dependency_count));
+                for (const auto &[path, mtime, size, hash]: dependencies) {
+                    const size_t path_length = path.size();
+                    cache_file.write(reinterpret_cast<const char *>(&path_length), sizeof(path_length));
+                    cache_file.write(path.data(), static_cast<long long>(path_length));
+                    cache_file.write(reinterpret_cast<const char *>(&mtime), sizeof(mtime));
+                    cache_file.write(reinterpret_cast<const char *>(&size), sizeof(size));
+                    cache_file.write(reinterpret_cast<const char *>(&hash), sizeof(hash));
+                }
+                serializeExecutableIns(cache_file, ins_set, utils::SerializationProfile::Debug);
+            }
+            std::filesystem::rename(temp_path, target_path);
+        }
+
+        std::shared_ptr<InsSet> CompileCache::load(const std::string &code_file_path) {
+            // 预编译链接会在解析期间写出 RSI 文件，此时不使用缓存
+            if (!env::compile_cache_option || env::precompiled_link_option) {
+                return parseCodeFromPath(code_file_path, false);
+            }
+            const auto &source_path = utils::getAbsolutePath(code_file_path);
+            const auto &cache_path = getCachePath(source_path);
+            try {
+                if (auto ins_set = read(cache_path, source_path)) {
+                    return ins_set;
+                }
+            } catch (const std::exception &) {
+                // 缓存损坏或版本不兼容时视为未命中，重新解析
+            }
+            recorded_paths_.clear();
+            auto ins_set = parseCodeFromPath(source_path, false);
+            try {
+                std::vector<Dependency> dependencies{Dependency::of(source_path)};
+                std::unordered_set<std::string> seen_paths{source_path};
+                for (const auto &path: recorded_paths_) {
+                    if (seen_paths.insert(path).second) {
+                        dependencies.push_back(Dependency::of(path));
+                    }
+                }
+                write(cache_path, ins_set, dependencies);
+            } catch (const std::exception &) {
+                // 缓存目录不可写等情况不影响本次运行
+            }
+            recorded_paths_.clear();
+            return ins_set;
+        }
+
+        bool CompileCache::clear(const std::string &code_file_path) {
+            const auto &cache_dir = std::filesystem::path(getCachePath(utils::getAbsolutePath(code_file_path)))
+                    .parent_path();
+            std::error_code ec;
+            return std::filesystem::remove_all(cache_dir, ec) > 0;
+        }
     }
 }
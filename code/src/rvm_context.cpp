@@ -0,0 +1,39 @@
+//
+// Created by RestRegular on 2026/10/19.
+//
+
+#include "../include/rvm_context.h"
+
+namespace parser {
+    namespace {
+        template<typename... State>
+        std::tuple<State *...> bindStates(const std::tuple<State *...> &states) {
+            return {base::ThreadBound<State>::bind(std::get<State *>(states))...};
+        }
+    }
+
+    VMContext::Binding::Binding(VMContext &context)
+        : previous_(bind({&context.io_, &context.working_directories_, &context.collector_, &context.quota_,
+                          &context.scope_registry_, context.memory_.get(), &context.execution_,
+                          &context.ins_set_pool_, &context.rasm_cache_})) {}
+
+    VMContext::Binding::~Binding() {
+        bind(previous_);
+    }
+
+    VMContext::Binding::States VMContext::Binding::bind(const States &states) {
+        return bindStates(states);
+    }
+
+    VMContext::VMContext() {
+        // 内存构造时创建的作用域与数据需登记、记账到本上下文
+        Binding binding(*this);
+        memory_ = std::make_unique<core::memory::RVM_Memory>();
+    }
+
+    VMContext::~VMContext() {
+        // 作用域与数据析构时可能访问当前虚拟机，需在绑定本上下文时释放
+        Binding binding(*this);
+        memory_.reset();
+    }
+}
@@ -7,6 +7,7 @@
 #include "../include/ra_base.h"
 #include "../include/ra_core.h"
 #include "../include/ra_parser.h"
+#include "../include/rvm_context.h"
 #include "../include/lib/newrcc.h"
 #include "../include/lib/ra_utils.h"
 
@@ -26,12 +27,17 @@ std::string program_working_directory_;
 bool program_run_executable_;
 bool program_serialize_;
 bool program_debug_option_;
+bool program_memo_check_option_;
 bool program_run_time_info_option_;
 bool program_help_option_;
 bool program_version_option_;
 bool program_vs_check_option_;
 bool program_rvm_work_directory_;
 bool program_get_ris_;
+bool program_no_compile_cache_;
+bool program_clear_compile_cache_;
+int program_fuel_limit_;
+int program_time_limit_ms_;
 
 void initializeArgumentParser() {
     argParser.addFlag("help", &program_help_option_, false, true,
@@ -67,6 +73,11 @@ void initializeArgumentParser() {
                       "This flag activates additional debugging information and tools "
                       "to assist in diagnosing issues during execution or compilation.",
                       {"d", "db"});
+    argParser.addFlag("memo-check", &program_memo_check_option_, false, true,
+                      "Enables purity checking for memoized functions. "
+                      "A function marked by MEMO that modifies data outside its own scope raises an error. "
+                      "This check is always enabled in debug mode.",
+                      {"mc"});
     argParser.addFlag("rvm-work-directory", &program_rvm_work_directory_, false, true,
                       "This flag is used to specify the rvm directory as the program's environment working directory.",
                       {"rwd"});
@@ -78,6 +89,14 @@ void initializeArgumentParser() {
     argParser.addFlag("get-ris", &program_get_ris_, false, true,
                       "This flag is used to get the hole RI names.",
                       {"ris", "gr"});
+    argParser.addFlag("no-compile-cache", &program_no_compile_cache_, false, true,
+                      "Disables the compile cache. By default, running an RA file stores the compiled "
+                      "instructions in the '__rvmcache__' directory next to the file and reuses them "
+                      "while the file and the files it links are unchanged.",
+                      {"ncc"});
+    argParser.addFlag("clear-compile-cache", &program_clear_compile_cache_, false, true,
+                      "Clears the compile cache directory next to the target file.",
+                      {"clcc"});
 
     argParser.addOption<std::string>("help-option", &program_help_option_name_,
                                                      "",
@@ -118,6 +137,38 @@ void initializeArgumentParser() {
                                      undefined_,
                                      "Specifies the working directory for the operation. ",
                                      {"wd"});
+    argParser.addOption<int>("rasm-cache-size", &env::rasm_cache_capacity, 64,
+                             "Specifies the maximum number of parsed code snippets kept by the "
+                             "EXE_RASM cache. The least recently used snippet is evicted when the cache is full. "
+                             "A value of 0 disables the cache.",
+                             {"rcs"});
+    argParser.addOption<int>("fuel", &program_fuel_limit_, 0,
+                             "Specifies the instruction fuel of the program. One unit of fuel is consumed "
+                             "at every safepoint: entering a loop iteration or a function call, and every backward jump. "
+                             "The program is aborted with a TimeoutError when the fuel runs out. "
+                             "A value of 0 disables the limit.",
+                             {"fl"});
+    argParser.addOption<int>("time-limit", &program_time_limit_ms_, 0,
+                             "Specifies the maximum running time of the program in milliseconds. "
+                             "The limit is checked at safepoints, and the program is aborted with a TimeoutError "
+                             "when it is exceeded. A value of 0 disables the limit.",
+                             {"tl"});
+    argParser.addOption<int>("gc-threshold", &memory::CycleCollector::threshold, 10000,
+                             "Specifies the number of newly created containers (List, Dict, KeyValuePair, "
+                             "custom types and instances) that triggers a cycle collection at the next safepoint. "
+                             "The threshold grows with the number of containers surviving the last collection. "
+                             "A value of 0 disables the collector.",
+                             {"gct"});
+    argParser.addOption<int>("heap-soft-limit", &memory::HeapQuota::soft_limit_mb, 0,
+                             "Specifies the soft heap limit of the program in megabytes. Payloads of strings, "
+                             "lists, dicts and custom instances are accounted, and reaching the limit triggers "
+                             "a cycle collection at the next safepoint. A value of 0 disables the limit.",
+                             {"hsl"});
+    argParser.addOption<int>("heap-limit", &memory::HeapQuota::hard_limit_mb, 0,
+                             "Specifies the hard heap limit of the program in megabytes. When the accounted "
+                             "payloads still exceed the limit after a cycle collection, a MemoryError is raised "
+                             "at the next safepoint. A value of 0 disables the limit.",
+                             {"hl"});
     argParser.addOption<bool>("enable-colorful-output",&cc::enableColorfulOutput, true,
                               "Enables or disables colorful terminal output. "
                               "This option respects the NO_COLOR environment variable "
@@ -143,11 +194,18 @@ void initializeArgumentParser() {
     argParser.addDependent(std::vector<std::string>{"run", "comp"}, "target",
                            ProgArgParser::CheckDir::UniDir);
     argParser.addDependent("debug", "run", ProgArgParser::CheckDir::UniDir);
+    argParser.addDependent(std::vector<std::string>{"fuel", "time-limit", "gc-threshold",
+                                                    "heap-soft-limit", "heap-limit"}, "run",
+                           ProgArgParser::CheckDir::UniDir);
     argParser.addDependent("vs-check", "target",
                            ProgArgParser::CheckDir::UniDir);
+    argParser.addDependent("clear-compile-cache", "target", ProgArgParser::CheckDir::UniDir);
+    argParser.addDependent("no-compile-cache", "run", ProgArgParser::CheckDir::UniDir);
 }
 
 int main(const int argc, char *argv[]){
+    VMContext context;
+    VMContext::Binding binding(context);
     try {
         initializeArgumentParser();
         argParser.parse(argc, argv);
@@ -157,22 +215,33 @@ int main(const int argc, char *argv[]){
             env::precompiled_link_dir_path = getAbsolutePath(env::precompiled_link_dir_path);
         }
         if (program_output_redirect_ != "console") {
-            io->setOutputToConsole(false);
-            io->setOutputToFile(program_output_redirect_);
+            io()->setOutputToConsole(false);
+            io()->setOutputToFile(program_output_redirect_);
         }
         if (program_debug_option_) {
             if (program_output_redirect_ != "console") {
                 throw std::runtime_error("Cannot redirect output to file when debug mode is enabled.");
             }
-            InsSet::debug_mode = DebugMode::Standard;
+            ExecutionState::current().debug_mode = DebugMode::Standard;
+        }
+        if (program_memo_check_option_ || program_debug_option_) {
+            ExecutionState::current().memo_purity_check = true;
+        }
+        if (program_clear_compile_cache_) {
+            if (parse::CompileCache::clear(program_target_file_path_)) {
+                *io() << "[RVM Msg] >> Compile cache cleared.\n";
+            } else {
+                *io() << "[RVM Msg] >> No compile cache to clear.\n";
+            }
         }
+        env::compile_cache_option = !program_no_compile_cache_;
         if (program_serialize_) {
             auto file_ext = getFileExtFromPath(program_target_file_path_);
             env::initialize(program_target_file_path_, program_working_directory_);
             const auto ins_set = parse::parseCodeFromPath(program_target_file_path_, false);
             parse::serializeExecutableInsToBinaryFile(program_archive_file_path_, ins_set,
                                                       env::program_serialization_profile_);
-            *io << "[RVM Msg] >> Compilation finished with ["
+            *io() << "[RVM Msg] >> Compilation finished with ["
                 << getSerializationProfileName(env::program_serialization_profile_) << "] profile.";
         }
         if (program_run_executable_) {
@@ -185,7 +254,7 @@ int main(const int argc, char *argv[]){
                         program_target_file_path_, env::program_serialization_profile_);
             } else if (file_ext == RA_EXT)
             {
-                ins_set = parse::parseCodeFromPath(program_target_file_path_, false);
+                ins_set = parse::CompileCache::load(program_target_file_path_);
             } else
             {
                 try
@@ -198,17 +267,21 @@ int main(const int argc, char *argv[]){
                 }
             }
             env::initialize(ins_set->scope_leader_file, program_working_directory_);
+            auto &budget = ExecutionState::current().budget;
+            budget.fuel_limit = program_fuel_limit_;
+            budget.time_limit_ms = program_time_limit_ms_;
+            budget.start();
             ins_set->execute();
         }
         if (program_help_option_) {
             if (program_help_option_name_.empty()) {
-                *io << argParser.getHelpString();
+                *io() << argParser.getHelpString();
             } else {
-                *io << argParser.getOptionDescription(program_help_option_name_);
+                *io() << argParser.getOptionDescription(program_help_option_name_);
             }
         }
         if (program_version_option_) {
-            *io << RVMSerialHeader::getRVMVersionInfo();
+            *io() << RVMSerialHeader::getRVMVersionInfo();
         }
         if (program_vs_check_option_) {
             auto file_ext = getFileExtFromPath(program_target_file_path_);
@@ -221,40 +294,68 @@ int main(const int argc, char *argv[]){
                 binary_file.close();
                 if (const auto version_info = rvm_serial_header.getRSIVersionInfo(program_target_file_path_);
                     version_info.empty()) {
-                    *io += "[RVM Error] >> No version information found in the target RSI file.";
+                    *io() += "[RVM Error] >> No version information found in the target RSI file.";
                 } else {
-                    *io << "[RVM Msg] >> " + version_info;
+                    *io() << "[RVM Msg] >> " + version_info;
                 }
             } catch (const std::exception &e) {
-                *io += "[RVM Error] >> " +
+                *io() += "[RVM Error] >> " +
                        StringManager::wrapText(
                                "Failed to retrieve the version information from the target RSI file. "
                                "This may be caused by file corruption or the use of a compilation mode that excludes "
                                "version details during the build process.", 80, 15);
-                *io += "\n[RVM Error] >> " + std::string(e.what());
+                *io() += "\n[RVM Error] >> " + std::string(e.what());
             }
         }
         if (program_get_ris_)
         {
-            for (const auto& riName: insNameMap | std::views::keys)
+            for (const auto& [riName, _]: ris::riTable.entries())
             {
-                *io << riName << " ";
+                std::string upperName{riName};
+                std::ranges::transform(upperName, upperName.begin(),
+                                       [](const unsigned char c) { return std::toupper(c); });
+                *io() << upperName << " ";
             }
         }
         if (program_run_time_info_option_) {
-            *io << printProgramSpentTimeInfo();
+            *io() << printProgramSpentTimeInfo();
+            if (const auto &[hits, misses, _] = parse::RasmCache::getInstance().getStats();
+                hits + misses > 0) {
+                std::ostringstream oss;
+                parse::RasmCache::getInstance().printInfo(oss);
+                *io() << oss.str();
+            }
+            if (const auto &[hits, misses] = parse::ExtensionCache::getInstance().getStats();
+                hits + misses > 0) {
+                std::ostringstream oss;
+                parse::ExtensionCache::getInstance().printInfo(oss);
+                *io() << oss.str();
+            }
+            std::ostringstream memo_oss;
+            MemoTable::printInfo(memo_oss);
+            *io() << memo_oss.str();
+            if (memory::CycleCollector::getStats().collections > 0) {
+                std::ostringstream gc_oss;
+                memory::CycleCollector::printInfo(gc_oss);
+                *io() << gc_oss.str();
+            }
+            if (memory::HeapQuota::soft_limit_mb > 0 || memory::HeapQuota::hard_limit_mb > 0) {
+                std::ostringstream heap_oss;
+                memory::HeapQuota::printInfo(heap_oss);
+                *io() << heap_oss.str();
+            }
         }
     } catch (RVM_Error &rvm_error) {
         if (rvm_serial_header.getProfile() < SerializationProfile::Release) {
-            *io += rvm_error.toString();
+            *io() += rvm_error.toString();
         } else {
-            *io += rvm_error.getErrorTitle() + rvm_error.getErrorInfo();
+            *io() += rvm_error.getErrorTitle() + rvm_error.getErrorInfo();
         }
     } catch (std::exception &e) {
-        *io += "[RVM Error] >> ";
-        *io += e.what();
+        *io() += "[RVM Error] >> ";
+        *io() += e.what();
     }
-    io->flushOutputCache();
-    data_space_pool.clearAllScopes();
+    io()->flushOutputCache();
+    data_space_pool().clearAllScopes();
     return 0;
 }
@@ -2,6 +2,7 @@
 // Created by RestRegular on 2025/3/19.
 //
 
+#include <cmath>
 #include <cstdlib>
 #include <filesystem>
 #include <utility>
@@ -9,102 +10,131 @@
 #include "../include/ra_parser.h"
 #include "../include/lib/newrcc.h"
 
-core::memory::RVM_Memory &data_space_pool = core::memory::RVM_Memory::getInstance();
-base::RVM_IO *io{base::RVM_IO::getInstance()};
+using core::memory::data_space_pool;
+using parser::io;
 
 namespace core::components {
-    std::unordered_map<int, const RI*> insMap{};
-    std::unordered_map<std::string, const RI*> insNameMap{};
-    id::DataID SR_SpaceID{};
-    id::DataID _SE_SpaceID{};
-
-    RI::RI(std::string name, const int arity,
-        const ExecutorFunc executor,
-        const bool isCreatedScope,
-        const bool isDelayedReleaseScope)
-            : name(std::move(name)),
-              arity(arity), executor(executor), hasScope(isCreatedScope),
-              isDelayedReleaseScope(isDelayedReleaseScope) {
-        memory::RVM_Memory::getInstance().addGlobalData(this->name,
-                                                        std::make_shared<data::String>(toString()));
-        base::categorizedKeywords[base::getKeywordTypeName(base::KeywordType::Instructions)].insert(this->name);
-        auto upper_name = this->name;
-        std::ranges::transform(upper_name, upper_name.begin(),
-                               [](const unsigned char c) { return std::toupper(c); });
-        insMap.insert({id.dis_id, this});
-        insNameMap.insert({upper_name, this});
-    }
-
-    bool RI::operator==(const RI &other) const {
-        return this->id == other.id;
-    }
-
-    bool RI::equalWith(const RI* other) const
-    {
-        return this->id == other->id;
+    std::string RI::toString() const {
+        return "[RI: " + std::string(this->name) + "]";
     }
 
-    std::string RI::toString() const {
-        return "[RI: " + this->name + "]";
+    std::string RI::getIDString() const {
+        std::string str = std::to_string(ris::riTable.indexOf(name));
+        if (str.length() < 6) {
+            str.insert(0, 6 - str.length(), '0');
+        }
+        return "<RI: Rx" + str + ">";
     }
 
-    // лл id
+    // ллָָе±
+    // id ȫּھ̬ʼʱ䣬ʼ˳仯ڳ־û
     void RI::serialize(std::ostream &os, const utils::SerializationProfile &profile) const {
-        os.write(reinterpret_cast<const char *>(&id.dis_id), sizeof(id.dis_id));
+        const int index = ris::riTable.indexOf(name);
+        os.write(reinterpret_cast<const char *>(&index), sizeof(index));
     }
 
-    // лͨ id  insMap ȡ
+    // лͨ±ָȡ
     const RI* RI::deserialize(std::istream& is, const utils::SerializationProfile& profile)
     {
-        int riid{};
-        is.read(reinterpret_cast<char *>(&riid), sizeof(riid));
-    
-        if (const auto &it = insMap.find(riid);
-            it != insMap.end())
+        int index{};
+        is.read(reinterpret_cast<char *>(&index), sizeof(index));
+
+        if (const auto &entries = ris::riTable.entries();
+            index >= 0 && static_cast<size_t>(index) < entries.size())
         {
-            return it->second;
+            return entries[index].value;
         }
-        throw std::runtime_error("Invalid RI id: " + std::to_string(riid));
+        throw std::runtime_error("Invalid RI index: " + std::to_string(index));
     }
 
     const RI* RI::getRIByStr(const std::string& content) {
-        // תΪдʵִСдƥ
-        std::string upperContent = content;
-        std::ranges::transform(upperContent, upperContent.begin(),
-                               [](const unsigned char c) { return std::toupper(c); });
-        // ָӳ
-        if (const auto &it = insNameMap.find(upperContent);
-            it != insNameMap.end()) {
-            return it->second;
+        // ָĹϣȽϾԴСд
+        const auto ri = ris::riTable.find(content);
+        return ri ? *ri : nullptr;
+    }
+
+    // ProgramArenaʵ
+    thread_local std::shared_ptr<ProgramArena> ProgramArena::current_ = nullptr;
+
+    ProgramArena::Scope::Scope(const size_t initial_size)
+            : Scope(std::make_shared<ProgramArena>(initial_size)) {}
+
+    ProgramArena::Scope::Scope(std::shared_ptr<ProgramArena> arena)
+            : previous_(std::exchange(current_, std::move(arena))), arg_text_scope_(current_->arg_texts_) {}
+
+    ProgramArena::Scope::~Scope() {
+        current_ = std::move(previous_);
+    }
+
+    std::pair<const SourceMap::File *, uint32_t> ProgramArena::addSourceLine(const std::string *filepath,
+                                                                            const std::string_view code) {
+        if (!current_) {
+            throw std::logic_error("Source lines can only be added while an arena is open.");
         }
-        return nullptr;
+        return current_->source_map_.addLine(filepath, code);
+    }
+
+    // SourceMapʵ
+    std::string_view SourceMap::File::line(const uint32_t index) const {
+        const size_t begin = line_offsets[index];
+        const size_t end = index + 1 < line_offsets.size() ? line_offsets[index + 1] : text.size();
+        return std::string_view(text).substr(begin, end - begin);
+    }
+
+    std::pair<const SourceMap::File *, uint32_t> SourceMap::addLine(const std::string *filepath,
+                                                                   const std::string_view code) {
+        auto &file = files_[filepath];
+        file.line_offsets.push_back(static_cast<uint32_t>(file.text.size()));
+        file.text += code;
+        return {&file, static_cast<uint32_t>(file.line_offsets.size() - 1)};
+    }
+
+    // InsSideRecordʵ
+    bool InsSideRecord::isUsedBy(const RI *ri) {
+        return ri->hasScope || ris::ADD.equalWith(ri) || ris::MUL.equalWith(ri) || ris::CALL.equalWith(ri) ||
+               ris::IVOK.equalWith(ri) || ris::EXT_GET.equalWith(ri) || ris::CMPJ.equalWith(ri) ||
+               ris::LIST_LIT.equalWith(ri) || ris::DICT_LIT.equalWith(ri);
     }
 
     // Insʵ
     Ins::Ins(utils::Pos pos, std::string raw_code, const RI *ri, StdArgs args,
              std::string ext)
-            : pos(std::move(pos)), ri(ri), args(std::move(args)),
-              scopeInsSet(std::make_shared<InsSet>(ri->name)), raw_code(std::move(raw_code)),
-              ext(std::move(ext)){
+            : pos(std::move(pos)), ri(ri), args(std::move(args), ProgramArena::resource()),
+              side_record(InsSideRecord::isUsedBy(ri) ? ProgramArena::makeOwned<InsSideRecord>() : nullptr),
+              executor(ri->executor),
+              ext(ext.empty() ? utils::SymbolTable::NO_SYMBOL : utils::SymbolTable::intern(ext)) {
+        std::tie(source_file, source_line) = ProgramArena::addSourceLine(&this->pos.getFilepath(), raw_code);
+        if (this->ri->hasScope) {
+            side_record->scopeInsSet = std::make_shared<InsSet>(std::string(this->ri->name));
+        }
         if (this->ri->arity != -1 && static_cast<int>(this->args.size()) != this->ri->arity) {
-            throw base::errors::ArgumentNumberError(this->pos.toString(), this->raw_code,
+            throw base::errors::ArgumentNumberError(this->pos.toString(), this->rawCode(),
                                                     std::to_string(this->ri->arity),
                                                     static_cast<int>(this->args.size()),
-                                                    this->ri->name, {});
+                                                    std::string(this->ri->name), {});
         }
     }
 
     ExecutionStatus Ins::execute(size_t &pointer) const {
-        return this->ri->executor(*this, pointer, args);
+        return executor(*this, pointer, args);
+    }
+
+    std::string Ins::rawCode() const {
+        return source_file ? std::string(source_file->line(source_line)) : std::string();
+    }
+
+    const std::string &Ins::extName() const {
+        static const std::string empty_ext;
+        return ext == utils::SymbolTable::NO_SYMBOL ? empty_ext : utils::SymbolTable::getName(ext);
     }
 
     void Ins::addIns(std::shared_ptr<Ins> ins) const {
         if (this->ri->hasScope) {
-            this->scopeInsSet->addIns(std::move(ins));
+            scopeInsSet()->addIns(std::move(ins));
         } else {
-            throw base::RVM_Error(base::ErrorType::RuntimeError, ins->pos.toString(), ins->raw_code,
+            throw base::RVM_Error(base::ErrorType::RuntimeError, ins->pos.toString(), ins->rawCode(),
                                   {"This error occurs when an Ins is added to an Ins without a domain.",
-                                   "Error Ins: " + ins->raw_code},
+                                   "Error Ins: " + ins->rawCode()},
                                   {"Check whether the target instruction contains internal instFields when adding instructions."});
         }
     }
@@ -128,12 +158,13 @@ namespace core::components {
         const bool hasScopeInsSet = ri->hasScope;
         os.write(reinterpret_cast<const char *>(&hasScopeInsSet), sizeof(hasScopeInsSet));
         if (hasScopeInsSet) {
-            scopeInsSet->serialize(os, profile);
+            scopeInsSet()->serialize(os, profile);
         }
 
         // л raw_code
         if (profile < utils::SerializationProfile::Testing) {
             // ڲģʽ£л raw_code
+            const auto &raw_code = rawCode();
             const size_t codeLength = raw_code.size();
             os.write(reinterpret_cast<const char *>(&codeLength), sizeof(codeLength));
             if (codeLength > 0) {
@@ -145,10 +176,11 @@ namespace core::components {
         os.write(reinterpret_cast<const char *>(&is_delayed_release_scope), sizeof(is_delayed_release_scope));
 
         // л ext_info
-        const size_t extLength = ext.size();
+        const auto &ext_name = extName();
+        const size_t extLength = ext_name.size();
         os.write(reinterpret_cast<const char *>(&extLength), sizeof(extLength));
         if (extLength > 0) {
-            os.write(ext.c_str(), static_cast<long long>(extLength));
+            os.write(ext_name.c_str(), static_cast<long long>(extLength));
         }
     }
 
@@ -159,6 +191,8 @@ namespace core::components {
 
         // л RI
         ri = RI::deserialize(is, profile);
+        executor = ri->executor;
+        side_record = InsSideRecord::isUsedBy(ri) ? ProgramArena::makeOwned<InsSideRecord>() : nullptr;
 
         // л StdArgs (std::vector<utils::Arg>)
         size_t argsSize;
@@ -174,10 +208,8 @@ namespace core::components {
         bool hasScopeInsSet;
         is.read(reinterpret_cast<char *>(&hasScopeInsSet), sizeof(hasScopeInsSet));
         if (hasScopeInsSet) {
-            scopeInsSet = std::make_shared<InsSet>(unknown_);
-            scopeInsSet->deserialize(is, profile);
-        } else {
-            scopeInsSet = nullptr;
+            side_record->scopeInsSet = std::make_shared<InsSet>(unknown_);
+            side_record->scopeInsSet->deserialize(is, profile);
         }
 
         // л raw_code
@@ -185,10 +217,12 @@ namespace core::components {
             size_t codeLength;
             is.read(reinterpret_cast<char *>(&codeLength), sizeof(codeLength));
             if (codeLength > 0) {
-                raw_code.resize(codeLength);
+                std::string raw_code(codeLength, '\0');
                 is.read(&raw_code[0], static_cast<long long>(codeLength));
+                std::tie(source_file, source_line) = ProgramArena::addSourceLine(&pos.getFilepath(), raw_code);
             } else {
-                raw_code.clear();
+                source_file = nullptr;
+                source_line = 0;
             }
         }
 
@@ -199,37 +233,385 @@ namespace core::components {
         size_t extLength;
         is.read(reinterpret_cast<char *>(&extLength), sizeof(extLength));
         if (extLength > 0) {
-            ext.resize(extLength);
-            is.read(&ext[0], static_cast<long long>(extLength));
+            std::string ext_name(extLength, '\0');
+            is.read(&ext_name[0], static_cast<long long>(extLength));
+            ext = utils::SymbolTable::intern(ext_name);
         } else {
-            ext.clear();
+            ext = utils::SymbolTable::NO_SYMBOL;
+        }
+    }
+
+    std::shared_ptr<AtmpLayout> AtmpLayout::split(const Ins &atmp_ins) {
+        const auto layout = std::make_shared<AtmpLayout>();
+        layout->attempt_ins_set = std::make_shared<InsSet>("ATMP");
+        layout->finally_ins_set = std::make_shared<InsSet>("FINALLY");
+        layout->attempt_ins_set->setScopeLeader(atmp_ins);
+        // ָֺԭָָ֮ͬڵڴ
+        layout->attempt_ins_set->shareArenasWith(*atmp_ins.scopeInsSet());
+        layout->finally_ins_set->shareArenasWith(*atmp_ins.scopeInsSet());
+
+        const auto &body = atmp_ins.scopeInsSet()->getInsSet();
+        // ԭÿָڲָֺеλ
+        std::vector<std::pair<InsSet *, int>> locations(body.size(), {nullptr, -1});
+        bool has_detect = false;
+        for (size_t i = 0; i < body.size(); ++i) {
+            const auto &inner_ins = body[i];
+            if (ris::DETECT.equalWith(inner_ins->ri)) {
+                has_detect = true;
+                layout->detect_ins_list.push_back(inner_ins);
+                continue;
+            }
+            const auto &target = has_detect ? layout->finally_ins_set : layout->attempt_ins_set;
+            locations[i] = {target.get(), static_cast<int>(target->getInsSet().size())};
+            target->addIns(inner_ins);
+        }
+
+        // Ǩ SET ıǩʹתָڲָֺжλ
+        for (const auto &[label, index]: atmp_ins.scopeInsSet()->getLabels()) {
+            if (index < 0 || static_cast<size_t>(index) >= body.size() ||
+                !ris::SET.equalWith(body[index]->ri)) {
+                continue;
+            }
+            if (const auto &[target, new_index] = locations[index]; target) {
+                target->setLabel(label, new_index);
+            }
+        }
+        return layout;
+    }
+
+    std::shared_ptr<ExtFieldCache> ExtFieldCache::build(const Ins &ext_get_ins) {
+        auto cache = std::make_shared<ExtFieldCache>();
+        if (ext_get_ins.args.size() > 1 && ext_get_ins.args[1].getType() == utils::ArgType::string) {
+            cache->field = ext_get_ins.args[1].getValue();
+            cache->literal_field = true;
+        }
+        return cache;
+    }
+
+    void ExtFieldCache::bind(const InsSet &ins_set, const utils::Symbol ident,
+                             const std::shared_ptr<data::Extension> &extension) {
+        for (const auto &ins: ins_set.getInsSet()) {
+            if (!ris::EXT_GET.equalWith(ins->ri) || ins->args.empty() || ins->args[0].getSymbol() != ident) {
+                continue;
+            }
+            auto &cache = ins->cached<ExtFieldCache>();
+            if (!cache) {
+                cache = build(*ins);
+            }
+            if (cache->extension != extension) {
+                cache->extension = extension;
+                cache->data.reset();
+            }
+        }
+    }
+
+    void AtmpLayout::resolveDetectTypes(const Ins &atmp_ins) {
+        std::vector<DetectBlock> blocks;
+        blocks.reserve(detect_ins_list.size());
+        for (const auto &detect_ins: detect_ins_list) {
+            // ǷϷ
+            const auto &arg0 = detect_ins->args[0];
+            if (arg0.getType() != utils::ArgType::identifier && arg0.getType() != utils::ArgType::keyword) {
+                throw base::errors::ArgTypeMismatchError(
+                        arg0.getPos().toString(), atmp_ins.rawCode(),
+                        {"Error Arg: " + arg0.toString(),
+                         "Expected Type: " + getTypeFormatString(utils::ArgType::identifier) +
+                         " or " + getTypeFormatString(utils::ArgType::keyword)},
+                        {"Check the type of the target argument of the " + ris::DETECT.toString() + "."});
+            }
+
+            // ȡͲ DetectBlock
+            auto detect_type = tools::getArgOriginData(arg0);
+            if (detect_type->getTypeID() != data::CustomType::typeId) {
+                throw base::errors::ArgTypeMismatchError(
+                        arg0.getPos().toString(), atmp_ins.rawCode(),
+                        {"Error Data: " + utils::getSpaceFormatString(arg0.getValue(),
+                                                                      detect_type->toString()),
+                         "Expected Type: " + data::CustomType::typeId.toString()},
+                        {"Check the type of the target argument of the " + ris::DETECT.toString() + "."});
+            }
+            blocks.emplace_back(static_pointer_cast<data::CustomType>(detect_type),
+                                detect_ins->args[1], detect_ins->scopeInsSet());
+        }
+        detect_blocks = std::move(blocks);
+        detect_resolved = true;
+    }
+
+    thread_local std::vector<std::weak_ptr<MemoTable>> MemoTable::registry_{};
+
+    MemoTable::MemoTable(std::string func_name, const size_t capacity)
+            : func_name_(std::move(func_name)), capacity_(capacity) {}
+
+    std::shared_ptr<MemoTable> MemoTable::create(const std::string &func_name, const size_t capacity) {
+        auto table = std::make_shared<MemoTable>(func_name, capacity);
+        registry_.push_back(table);
+        return table;
+    }
+
+    std::optional<std::string> MemoTable::makeKey(const std::vector<std::shared_ptr<base::RVM_Data>> &args,
+                                                  const size_t arg_count) {
+        std::string key;
+        for (size_t i = 0; i < arg_count && i < args.size(); ++i) {
+            // ʵ뺯ݿܴӡͬݲͬڵ֮ԭ޸ģ˲뻺
+            const auto &type = args[i]->getTypeID();
+            if (!type.fullEqualWith(data::Int::typeId) && !type.fullEqualWith(data::Float::typeId) &&
+                !type.fullEqualWith(data::Char::typeId) && !type.fullEqualWith(data::Bool::typeId) &&
+                !type.fullEqualWith(data::String::typeId) && !type.fullEqualWith(data::Null::typeId)) {
+                return std::nullopt;
+            }
+            // 볤ǰ׺֤ͬĲвƴӳͬļ
+            const auto &value = args[i]->getValStr();
+            key += type.toString();
+            key += '#';
+            key += std::to_string(value.size());
+            key += ':';
+            key += value;
         }
+        return key;
+    }
+
+    std::shared_ptr<base::RVM_Data> MemoTable::find(const std::string &key) {
+        const auto it = index_.find(key);
+        if (it == index_.end()) {
+            ++stats_.misses;
+            return nullptr;
+        }
+        ++stats_.hits;
+        entries_.splice(entries_.begin(), entries_, it->second);
+        return entries_.front().value;
+    }
+
+    void MemoTable::store(const std::string &key, std::shared_ptr<base::RVM_Data> value) {
+        if (capacity_ == 0) {
+            return;
+        }
+        if (const auto it = index_.find(key); it != index_.end()) {
+            it->second->value = std::move(value);
+            entries_.splice(entries_.begin(), entries_, it->second);
+            return;
+        }
+        entries_.push_front({key, std::move(value)});
+        index_[key] = entries_.begin();
+        setCapacity(capacity_);
+    }
+
+    void MemoTable::setCapacity(const size_t capacity) {
+        capacity_ = capacity;
+        while (entries_.size() > capacity_) {
+            index_.erase(entries_.back().key);
+            entries_.pop_back();
+            ++stats_.evictions;
+        }
+    }
+
+    void MemoTable::clear() {
+        entries_.clear();
+        index_.clear();
+    }
+
+    void MemoTable::printInfo(std::ostream &out) {
+        bool has_info = false;
+        for (const auto &weak_table: registry_) {
+            const auto table = weak_table.lock();
+            if (!table || table->stats_.hits + table->stats_.misses == 0) {
+                continue;
+            }
+            if (!has_info) {
+                out << "\n=== MemoTable Information ===\n";
+                has_info = true;
+            }
+            out << "Function: " << table->func_name_
+                << ", Capacity: " << table->capacity_
+                << ", Entries: " << table->entries_.size()
+                << ", Hits: " << table->stats_.hits
+                << ", Misses: " << table->stats_.misses
+                << ", Evictions: " << table->stats_.evictions << "\n";
+        }
+        if (has_info) {
+            out << "=== End of MemoTable Information ===\n";
+        }
+    }
+
+    std::shared_ptr<FusedCompare> FusedCompare::build(const Ins &cmpj_ins) {
+        const auto fused = std::make_shared<FusedCompare>();
+        fused->relation = base::stringToRelational(cmpj_ins.args[2].getValue());
+        for (size_t i = 0; i < fused->constants.size(); ++i) {
+            if (const auto &arg = cmpj_ins.args[i];
+                arg.getType() != utils::ArgType::identifier && arg.getType() != utils::ArgType::keyword) {
+                fused->constants[i] = tools::getArgOriginData(arg);
+            }
+        }
+        return fused;
+    }
+
+    std::shared_ptr<ConstantContainer> ConstantContainer::build(const Ins &literal_ins, const bool is_dict) {
+        const auto container = std::make_shared<ConstantContainer>();
+        const size_t item_count = literal_ins.args.size() - 1;
+        if (is_dict && item_count % 2 != 0) {
+            throw base::errors::ArgumentNumberError(literal_ins.pos.toString(), literal_ins.rawCode(),
+                                                    "2n + 1", literal_ins.args.size(),
+                                                    literal_ins.ri->toString(),
+                                                    {"The keys and values of the " + literal_ins.ri->toString() +
+                                                     " must appear in pairs before the target argument."});
+        }
+        container->items.reserve(item_count);
+        for (size_t i = 0; i < item_count; ++i) {
+            const auto &arg = literal_ins.args[i];
+            // ֵַֻ true / false / null ؼ֣֤غڶִ֮䲻
+            if (const auto &arg_type = arg.getType();
+                arg_type != utils::ArgType::number && arg_type != utils::ArgType::string &&
+                !(arg_type == utils::ArgType::keyword &&
+                  (arg.getValue() == "true" || arg.getValue() == "false" || arg.getValue() == "null"))) {
+                throw base::errors::ArgTypeMismatchError(arg.getPosStr(), literal_ins.rawCode(),
+                                                         {"The elements of the " + literal_ins.ri->toString() +
+                                                          " must be literals.",
+                                                          "Error Arg: " + arg.toString()},
+                                                         {"Use the " + ris::ITER_APND.toString() + " or the " +
+                                                          ris::DICT_SET.toString() +
+                                                          " to add non-literal data to a container."});
+            }
+            container->items.push_back(tools::getArgOriginData(arg)->copy_ptr());
+        }
+        if (is_dict) {
+            container->keys.reserve(item_count / 2);
+            std::unordered_set<std::string> key_set{};
+            for (size_t i = 0; i < item_count; i += 2) {
+                auto key = container->items[i]->toEscapedString();
+                if (!key_set.insert(key).second) {
+                    throw base::errors::DuplicateKeyError(literal_ins.args[i].getPosStr(), literal_ins.rawCode(),
+                                                          {"Duplicate Key: " + key},
+                                                          {"Remove the duplicate key from the " +
+                                                           literal_ins.ri->toString() + "."});
+                }
+                container->keys.push_back(std::move(key));
+            }
+        }
+        return container;
     }
 
-    AtmpBlock::AtmpBlock(std::vector<std::shared_ptr<DetectBlock>> detectBlocks, std::shared_ptr<InsSet> block_ins_set,
-                         std::shared_ptr<InsSet> finally_block_ins_set)
-            : detect_blocks(std::move(detectBlocks)), block_ins_set(std::move(block_ins_set)),
-              finally_block_ins_set(std::move(finally_block_ins_set)) {}
+    std::shared_ptr<base::RVM_Data> ConstantContainer::instantiate(const bool is_dict) const {
+        // Ԫؿܱԭ޸ģÿִжԪأغɱᱩ¶
+        if (!is_dict) {
+            std::vector<std::shared_ptr<base::RVM_Data>> values;
+            values.reserve(items.size());
+            for (const auto &item: items) {
+                values.push_back(item->copy_ptr());
+            }
+            return std::make_shared<data::List>(values);
+        }
+        std::unordered_map<std::string, std::shared_ptr<data::KeyValuePair>> pairs;
+        pairs.reserve(keys.size());
+        for (size_t i = 0; i < keys.size(); ++i) {
+            pairs.emplace(keys[i], std::make_shared<data::KeyValuePair>(items[i * 2]->copy_ptr(),
+                                                                        items[i * 2 + 1]->copy_ptr()));
+        }
+        return std::make_shared<data::Dict>(std::move(pairs), keys);
+    }
 
     DetectBlock::DetectBlock(std::shared_ptr<data::CustomType> detected_type,
                              utils::Arg error_stored_data, std::shared_ptr<InsSet> block_ins_set)
             : detected_type(std::move(detected_type)), error_stored_arg(std::move(error_stored_data)),
               block_ins_set(std::move(block_ins_set)) {}
 
-    std::stack<InsSet*> InsSet::exe_stack{};
-
-    std::vector<std::shared_ptr<AtmpBlock>> InsSet::atmp_stack{};
+    void ExecutionBudget::start() {
+        consumed_ = 0;
+        batch_ = fuel_limit > 0 ? std::min(fuel_limit, CHECK_INTERVAL) : CHECK_INTERVAL;
+        countdown_ = batch_;
+        memory::HeapQuota::start();
+        if (time_limit_ms > 0) {
+            deadline_ = std::chrono::steady_clock::now() + std::chrono::milliseconds(time_limit_ms);
+        }
+    }
 
-    DebugMode InsSet::debug_mode = DebugMode::None;
+    const Ins *ExecutionState::currentIns() const {
+        if (exe_stack.empty()) {
+            return nullptr;
+        }
+        const auto &ins_set = exe_stack.top();
+        if (const auto &ins_list = ins_set->getInsSet();
+            !ins_set->pointers.empty() && *ins_set->pointers.top() < ins_list.size()) {
+            return ins_list[*ins_set->pointers.top()].get();
+        }
+        return nullptr;
+    }
 
-    std::string InsSet::file_record{};
+    void ExecutionBudget::check() {
+        // ԵǰִеָΪλ
+        std::string error_pos = unknown_, error_line = unknown_;
+        if (const auto *ins = ExecutionState::current().currentIns()) {
+            error_pos = ins->pos.toString();
+            error_line = ins->rawCode();
+        }
+        if (base::PROGRAM_INTERRUPTED) {
+            throw base::errors::InterruptError(error_pos, error_line);
+        }
+        if (memory::HeapQuota::underPressure() && !memory::HeapQuota::relieve()) {
+            throw base::errors::MemoryError(error_pos, error_line, memory::HeapQuota::getReport(),
+                                            {"Release data that is no longer needed, "
+                                             "or raise the limit with the '--heap-limit' option."});
+        }
+        if (countdown_ > 0) {
+            return;
+        }
+        consumed_ += batch_;
+        if (fuel_limit > 0 && consumed_ >= fuel_limit) {
+            throw base::errors::TimeoutError(error_pos, error_line,
+                                             {"Fuel Limit: " + std::to_string(fuel_limit)},
+                                             {"Check the program for endless loops or recursion, "
+                                              "or raise the limit with the '--fuel' option."});
+        }
+        if (time_limit_ms > 0 && std::chrono::steady_clock::now() >= deadline_) {
+            throw base::errors::TimeoutError(error_pos, error_line,
+                                             {"Time Limit: " + std::to_string(time_limit_ms) + " ms",
+                                              "Consumed Fuel: " + std::to_string(consumed_)},
+                                             {"Check the program for endless loops or recursion, "
+                                              "or raise the limit with the '--time-limit' option."});
+        }
+        memory::CycleCollector::collectIfNeeded();
+        batch_ = fuel_limit > 0
+                 ? static_cast<int>(std::min<long long>(fuel_limit - consumed_, CHECK_INTERVAL))
+                 : CHECK_INTERVAL;
+        countdown_ = batch_;
+    }
 
     void InsSet::insertInsSet(const std::shared_ptr<InsSet>& insSet_) {
+        // ָıǩָһͬƫƣ֤еתָڵǰָȻЧ
+        const int offset = static_cast<int>(this->insSet.size());
+        for (const auto &[label, label_pointer]: insSet_->set_labels) {
+            set_labels[label] = label_pointer + offset;
+        }
+        is_verified = false;
         this->insSet.reserve(this->insSet.size() + insSet_->insSet.size());
         this->insSet.insert(this->insSet.end(), insSet_->insSet.begin(), insSet_->insSet.end());
+        shareArenasWith(*insSet_);
+    }
+
+    void InsSet::shareArenasWith(const InsSet &other) {
+        for (const auto &arena: other.arenas_) {
+            if (std::ranges::find(arenas_, arena) == arenas_.end()) {
+                arenas_.push_back(arena);
+            }
+        }
+    }
+
+    const std::shared_ptr<ProgramArena> &InsSet::arena() {
+        if (arenas_.empty()) {
+            arenas_.push_back(std::make_shared<ProgramArena>(ProgramArena::DEFAULT_INITIAL_SIZE));
+        }
+        return arenas_.front();
+    }
+
+    InsSet::~InsSet() {
+        // ָڴУͷڴ֮ǰͷ
+        insSet.clear();
+        // ϵ㲹ָͷʱƳԭִк¼ַµָúƥ
+        if (breakpoint_epoch != 0) {
+            ExecutionState::current().breakpoints.forget(this);
+        }
     }
 
     void InsSet::addIns(std::shared_ptr<Ins> ins) {
+        is_verified = false;
         insSet.push_back(std::move(ins));
     }
 
@@ -242,7 +624,7 @@ namespace core::components {
     }
 
     void InsSet::setScopeLeader(const Ins &leaderIns) {
-        scope_leader = leaderIns.raw_code;
+        scope_leader = leaderIns.rawCode();
         scope_leader_pos = leaderIns.pos.toString();
         scope_leader_file = leaderIns.pos.getFilepath();
     }
@@ -270,20 +652,90 @@ namespace core::components {
     /ns  -normalSkip        :ָͨϵ㴦
     /cls -cleanScreen       :տ̨
     /vn  -viewName          :ָƵ
-    /bp  -breakPoint        :Ӷϵ㣬Ϊϵкţոָ
-    /rp  -removePoint       :Ƴϵ㣬Ϊϵкţոָ
+    /bp  -breakPoint        :ڵǰļӶϵ㣬Ϊϵкţոָ
+    /rp  -removePoint       :ƳǰļеĶϵ㣬Ϊϵкţոָ
     /pcc -printCallChain    :ӡϢ
 )", cc::TextColor::GREEN);
 
-    std::unordered_set<int> break_points{};
+    bool BreakpointTable::add(const std::string *filepath, const int line) {
+        if (!filepath || line <= 0 || !lines_.emplace(filepath, line).second) {
+            return false;
+        }
+        ++epoch_;
+        patchActiveInsSets();
+        return true;
+    }
+
+    bool BreakpointTable::remove(const std::string *filepath, const int line) {
+        if (lines_.erase({filepath, line}) == 0) {
+            return false;
+        }
+        ++epoch_;
+        patchActiveInsSets();
+        return true;
+    }
+
+    void BreakpointTable::patch(InsSet &ins_set) {
+        const auto &ins_list = ins_set.getInsSet();
+        for (size_t i = 0; i < ins_list.size(); ++i) {
+            const auto &ins = ins_list[i];
+            const bool is_trapped = ins->executor == trap;
+            if (lines_.contains({&ins->pos.getFilepath(), ins->pos.getLine()})) {
+                if (!is_trapped) {
+                    original_executors_[{&ins_set, i}] = ins->executor;
+                    ins->executor = trap;
+                }
+            } else if (is_trapped) {
+                const auto it = original_executors_.find({&ins_set, i});
+                ins->executor = it->second;
+                original_executors_.erase(it);
+            }
+        }
+        ins_set.breakpoint_epoch = epoch_;
+    }
+
+    void BreakpointTable::patchActiveInsSets() {
+        // ϵָͨڼ飬£ָ´νʱ
+        for (auto active = ExecutionState::current().exe_stack; !active.empty(); active.pop()) {
+            if (active.top()->breakpoint_epoch != epoch_) {
+                patch(*active.top());
+            }
+        }
+    }
+
+    void BreakpointTable::forget(const InsSet *ins_set) {
+        std::erase_if(original_executors_, [ins_set](const auto &entry) {
+            return entry.first.first == ins_set;
+        });
+    }
+
+    ExecutionStatus BreakpointTable::trap(const Ins &ins, size_t &pointer, const StdArgs &args) {
+        // 庯ִֻѭãpointer ָڵǰָе±
+        auto &state = ExecutionState::current();
+        auto &table = state.breakpoints;
+        const Location location{state.exe_stack.top(), pointer};
+        // ԽпƳöϵ㣬ȸԭִк
+        const auto original = table.original_executors_.at(location);
+        state.debug_mode = DebugMode::Standard;
+        InsSet::debug_process(nullptr);
+        const auto res = original(ins, pointer, args);
+        // ԭִкִ滻ȥŻʱ¼µִкָ
+        if (const auto it = table.original_executors_.find(location);
+            ins.executor != trap && it != table.original_executors_.end()) {
+            it->second = ins.executor;
+            ins.executor = trap;
+        }
+        return res;
+    }
 
     void InsSet::printDebugExeStackInfo(const bool& hasError) {
-        io->immediateOutput(">> ", cc::colorfulText("Current call chain info:\n", cc::TextColor::LIGHT_GRAY, {cc::Decoration::BOLD}));
+        auto &state = ExecutionState::current();
+        io()->immediateOutput(">> ", cc::colorfulText("Current call chain info:\n", cc::TextColor::LIGHT_GRAY, {cc::Decoration::BOLD}));
 
         const auto &identSpace = "    ";
 
-        if (exe_stack.empty()) {
-            io->immediateOutput(
+        if (state.exe_stack.empty()) {
+            io()->immediateOutput(
                 identSpace,
                 cc::colorfulText(
                     "->Process has finished without any errors.\n",
@@ -295,7 +747,7 @@ namespace core::components {
             // 洢ִջԪؼջеλãջ׵ջ
             std::vector<std::pair<InsSet*, int>> stack_elements;
             // ִջʱջ
-            std::stack<InsSet*> temp_stack = exe_stack;
+            std::stack<InsSet*> temp_stack = state.exe_stack;
             int stack_index = 0;
             // ռִջеԪؼλϢ
             while (!temp_stack.empty()) {
@@ -321,7 +773,7 @@ namespace core::components {
                     const auto &ins = ins_set->insSet[*temp_pointers.top()];
                     const bool is_top_element = (last == 0); // ǷΪջԪ
                     // ʽջԪ"->"ǣ"v"
-                    io->immediateOutput(
+                    io()->immediateOutput(
                         identSpace,
                         cc::colorfulText("| ", cc::TextColor::CYAN), // ǳɫ
                         target_depth == 0
@@ -339,11 +791,11 @@ namespace core::components {
                             cc::colorfulText("v ", cc::TextColor(100, 200, 255)), // ǳɫͷ
                         target_depth == 0
                             ? (is_top_element
-                                   ? cc::colorfulText(ins->raw_code, cc::TextColor(0, 255, 100), {cc::Decoration::BOLD})
+                                   ? cc::colorfulText(ins->rawCode(), cc::TextColor(0, 255, 100), {cc::Decoration::BOLD})
                                    : // ɫ
-                                   cc::colorfulText(ins->raw_code, cc::TextColor(180, 180, 180)))
+                                   cc::colorfulText(ins->rawCode(), cc::TextColor(180, 180, 180)))
                             : // ǳɫ
-                            cc::colorfulText(ins->raw_code, cc::TextColor(120, 120, 120)), // ɫ
+                            cc::colorfulText(ins->rawCode(), cc::TextColor(120, 120, 120)), // ɫ
                         "\n");
                 }
                 last--;
@@ -351,7 +803,7 @@ namespace core::components {
         }
         if (hasError)
         {
-            io->immediateOutput(
+            io()->immediateOutput(
                 ">> ",
                 cc::colorfulText(
                     "RVM encountered error.",
@@ -360,74 +812,74 @@ namespace core::components {
                 ),
                 "\n");
         }
-        if (debug_mode == DebugMode::NormalSkip) {
-            io->immediateOutput("<< ", cc::colorfulText("[skip]", cc::TextColor(120, 120, 120)), "\n");
+        if (state.debug_mode == DebugMode::NormalSkip) {
+            io()->immediateOutput("<< ", cc::colorfulText("[skip]", cc::TextColor(120, 120, 120)), "\n");
         }
     }
 
     void InsSet::debug_process(const std::shared_ptr<Ins> &_, const bool &hasError) {
-        io->flushOutputCache();
+        auto &state = ExecutionState::current();
+        io()->flushOutputCache();
         printDebugExeStackInfo(hasError);
-        while (debug_mode == DebugMode::Standard) {
-            io->immediateOutput("<< ");
-            io->readLineAndSplit();
-            if (const auto &input = io->hasNextString() ? io->nextString() : "";
+        // ϵкڵǰִλڵļ
+        const auto *current_ins = state.currentIns();
+        const std::string *current_file = current_ins ? &current_ins->pos.getFilepath() : nullptr;
+        while (state.debug_mode == DebugMode::Standard) {
+            io()->immediateOutput("<< ");
+            io()->readLineAndSplit();
+            if (const auto &input = io()->hasNextString() ? io()->nextString() : "";
                 input.empty()) {
-                if (debug_mode != DebugMode::Standard) {
-                    debug_mode = DebugMode::Standard;
+                if (state.debug_mode != DebugMode::Standard) {
+                    state.debug_mode = DebugMode::Standard;
                 }
                 break;
             } else if (input == "/?" || input == "-help") { // 
-                io->immediateOutput(debug_command_help);
+                io()->immediateOutput(debug_command_help);
             } else if (input == "/p" || input == "-print") { // ӡݳ
-                data_space_pool.printPoolInfo();
-                io->flushOutputCache();
+                data_space_pool().printPoolInfo();
+                io()->flushOutputCache();
             } else if (input == "/e" || input == "-exit") { // ˳
-                data_space_pool.clearAllScopes();
-                *io << ">> " << cc::colorfulText("Exit RVM Debug Environment.", cc::TextColor::GREEN, {cc::Decoration::BOLD});
-                io->flushOutputCache();
-                io->flashInputCache();
+                data_space_pool().clearAllScopes();
+                *io() << ">> " << cc::colorfulText("Exit RVM Debug Environment.", cc::TextColor::GREEN, {cc::Decoration::BOLD});
+                io()->flushOutputCache();
+                io()->flashInputCache();
                 exit(-1);
             } else if (input == "/fs" || input == "-fastSkip") { // 
-                debug_mode = DebugMode::FastSkip;
+                state.debug_mode = DebugMode::FastSkip;
                 break;
             } else if (input == "/ns" || input == "-normalSkip") {
-                debug_mode = DebugMode::NormalSkip;
+                state.debug_mode = DebugMode::NormalSkip;
                 break;
             } else if (input == "/cls" || input == "-clearScreen") {
                 system("cls");
             } else if (input == "/vn" || input == "-viewName") {
-                while (io->hasNextString()) {
-                    const auto &view_item = io->nextString();
-                    if (const auto &[fst, snd] = data_space_pool.findDataByNameNoLock(view_item);
+                while (io()->hasNextString()) {
+                    const auto &view_item = io()->nextString();
+                    if (const auto &[fst, snd] = data_space_pool().findDataByNameNoLock(view_item);
                         snd != nullptr) {
-                        io->immediateOutput(snd->toString(), "\n");
+                        io()->immediateOutput(snd->toString(), "\n");
                     } else {
-                        io->immediateOutputError("Invalid data name: '", view_item, "'\n");
+                        io()->immediateOutputError("Invalid data name: '", view_item, "'\n");
                     }
                 }
             } else if (input == "/bp" || input == "-breakPoint") { // Ӷϵ
-                while (io->hasNextString()) {
-                    if (const auto &break_point = utils::stringToInt(io->nextString());
-                        break_point > 0 && !break_points.contains(break_point)) {
-                        break_points.insert(break_point);
-                    } else {
-                        io->immediateOutputError("Invalid break point: '", break_point, "'\n");
+                while (io()->hasNextString()) {
+                    if (const auto &break_point = utils::stringToInt(io()->nextString());
+                        !state.breakpoints.add(current_file, break_point)) {
+                        io()->immediateOutputError("Invalid break point: '", break_point, "'\n");
                     }
                 }
             } else if (input == "/rp" || input == "-r") {
-                while (io->hasNextString()) {
-                    if (const auto &break_point = utils::stringToInt(io->nextString());
-                        break_points.contains(break_point)) {
-                        break_points.erase(break_point);
-                    } else {
-                        io->immediateOutputError("Invalid break point: '", break_point, "'\n");
+                while (io()->hasNextString()) {
+                    if (const auto &break_point = utils::stringToInt(io()->nextString());
+                        !state.breakpoints.remove(current_file, break_point)) {
+                        io()->immediateOutputError("Invalid break point: '", break_point, "'\n");
                     }
                 }
             } else if (input == "/pcc" || input == "-printCallChain") {
                 printDebugExeStackInfo(hasError);
             } else {
-                io->immediateOutputError("Invalid debug command: '" + input + "'\n");
+                io()->immediateOutputError("Invalid debug command: '" + input + "'\n");
             }
         }
     }
@@ -460,140 +912,185 @@ namespace core::components {
         return ss.str();
     }
 
-    std::shared_ptr<memory::RVM_Scope> InsSet::loadinExtension(const std::string &ext_name) {
-        if (!ext_name.empty() && !data_space_pool.checkScopeExistNoLock(ext_name)) {
-            std::shared_ptr<data::Extension> ext;
-            if (tools::checkExtensionExistStrict(ext_name)) {
-                ext = memory::loadedExtensions[ext_name];
-            } else {
-                const auto &[_, res_ext] = data_space_pool.findDataByNameNoLock(ext_name);
-                if (res_ext && res_ext->getTypeID().fullEqualWith(data::Extension::typeId)) {
-                    ext = std::static_pointer_cast<data::Extension>(res_ext);
-                }
-                else {
-                    const auto &lastExeStack = exe_stack.top();
-                    const auto &lastIns = lastExeStack->insSet[*lastExeStack->pointers.top()];
-                    throw base::errors::MemoryError(lastIns->pos.toString(), lastIns->raw_code,
-                                                    {"This error is caused by a mismatch between the data type stored "
-                                                     "by the memory entity in memory and the required data type.",
-                                                     "Error space: " +
-                                                     utils::getSpaceFormatString(
-                                                             ext_name,
-                                                             ext ? ext->toString() : data::nullInstance.toString()),
-                                                     "Error type: " + (ext ? ext->getTypeID().toString()
-                                                                           : data::nullInstance.getTypeID().toString()),
-                                                     "Expected type: " + data::Extension::typeId.toString()},
-                                                    {"This error may be caused by an internal system error. Please contact "
-                                                     "the RVM developers (https://github.com/RestRegular) for assistance."});
-                }
-            }
-            const auto &ext_scope = ext->extension_scope;
-            if (ext_scope->isAddable()) {
-                ext_scope->setAddable(false);
-            }
-            data_space_pool.appendScopeNoLock(ext_scope);
-            return ext_scope;
+    std::shared_ptr<memory::RVM_Scope> InsSet::loadinExtension() {
+        if (insSet.empty() || insSet[0]->ext == utils::SymbolTable::NO_SYMBOL) {
+            return nullptr;
         }
-        return nullptr;
+        auto ext_scope = bound_ext_scope.lock();
+        if (!ext_scope) {
+            // չΪ淶չ·չʶͬ˽ʵ
+            ext_scope = resolveExtensionScope(insSet[0]->extName());
+            bound_ext_scope = ext_scope;
+        }
+        if (data_space_pool().checkScopeExistNoLock(ext_scope)) {
+            return nullptr;
+        }
+        if (ext_scope->isAddable()) {
+            ext_scope->setAddable(false);
+        }
+        data_space_pool().appendScopeNoLock(ext_scope);
+        return ext_scope;
+    }
+
+    std::shared_ptr<memory::RVM_Scope> InsSet::resolveExtensionScope(const std::string &ext_name) {
+        std::shared_ptr<data::Extension> ext;
+        if (tools::checkExtensionExistStrict(ext_name)) {
+            ext = data_space_pool().loaded_extensions[ext_name];
+        } else {
+            const auto &[_, res_ext] = data_space_pool().findDataByNameNoLock(ext_name);
+            if (res_ext && res_ext->getTypeID().fullEqualWith(data::Extension::typeId)) {
+                ext = std::static_pointer_cast<data::Extension>(res_ext);
+            }
+            else {
+                // ָʱѹִջ֮ǰչʱûִеָ
+                const auto *lastIns = ExecutionState::current().currentIns();
+                throw base::errors::MemoryError(lastIns ? lastIns->pos.toString() : unknown_,
+                                                lastIns ? lastIns->rawCode() : unknown_,
+                                                {"This error is caused by a mismatch between the data type stored "
+                                                 "by the memory entity in memory and the required data type.",
+                                                 "Error space: " +
+                                                 utils::getSpaceFormatString(
+                                                         ext_name,
+                                                         ext ? ext->toString() : data::nullInstance.toString()),
+                                                 "Error type: " + (ext ? ext->getTypeID().toString()
+                                                                       : data::nullInstance.getTypeID().toString()),
+                                                 "Expected type: " + data::Extension::typeId.toString()},
+                                                {"This error may be caused by an internal system error. Please contact "
+                                                 "the RVM developers (https://github.com/RestRegular) for assistance."});
+            }
+        }
+        return ext->extension_scope;
     }
 
     void InsSet::unloadExtension(const std::shared_ptr<memory::RVM_Scope> &ext_data) {
         if (ext_data != nullptr) {
-            data_space_pool.removeScopeNoLock(ext_data);
+            data_space_pool().removeScopeNoLock(ext_data);
         }
     }
 
     void InsSet::handleError(const std::shared_ptr<size_t> &pointer, base::RVM_Error &error) const {
+        auto &state = ExecutionState::current();
         const auto &error_pos = insSet[*pointer]->pos;
-        if (file_record.empty()) {
-            file_record = error_pos.getFilepath();
+        if (state.file_record.empty()) {
+            state.file_record = error_pos.getFilepath();
         }
         error.addTraceInfo(getTraceInfo(
-                file_record,
+                state.file_record,
                 error_pos.getFilepath(),
-                utils::getPosStrFromFilePath(file_record),
-                this->makeFileIdentiFromPath(file_record),
+                utils::getPosStrFromFilePath(state.file_record),
+                this->makeFileIdentiFromPath(state.file_record),
                 utils::listJoin(error.trace_info),
                 error_pos.toString(),
-                insSet[*pointer]->raw_code,
+                insSet[*pointer]->rawCode(),
                 scope_leader_pos,
                 scope_leader
         ));
-        if (file_record != error_pos.getFilepath()) {
-            file_record = error_pos.getFilepath();
+        if (state.file_record != error_pos.getFilepath()) {
+            state.file_record = error_pos.getFilepath();
         }
-        if (debug_mode != DebugMode::None) {
-            debug_mode = DebugMode::Standard;
+        if (state.debug_mode != DebugMode::None) {
+            state.debug_mode = DebugMode::Standard;
             debug_process(insSet[*pointer], true);
         }
     }
 
+    template<bool Debugging>
+    ExecutionStatus InsSet::run(const std::shared_ptr<size_t> &pointer) {
+        auto &state = ExecutionState::current();
+        ExecutionStatus resultStatus{};
+        while (*pointer < insSet.size()) {
+            const int &pointer_num = *pointer;
+            if constexpr (Debugging) {
+                // ϵָ庯Խ˴ִֻ
+                if ((state.debug_mode == DebugMode::Standard || state.debug_mode == DebugMode::NormalSkip) &&
+                    insSet[pointer_num]->executor != BreakpointTable::trap) {
+                    debug_process(insSet[pointer_num]);
+                }
+            }
+            resultStatus = insSet[pointer_num]->execute(*pointer);
+            if (resultStatus == ExecutionStatus::Aborted || resultStatus == ExecutionStatus::AbortedLoop
+                || resultStatus == ExecutionStatus::AbortedFunction) {
+                break;
+            }
+            if (resultStatus == ExecutionStatus::ExposedError)
+            {
+                if (const auto &se = data_space_pool().findDataByIDNoLock(state.se_space_id);
+                    se && se->getTypeID().fullEqualWith(data::Error::typeId)) {
+                    const auto &seData = static_pointer_cast<data::Error>(se);
+                    handleError(pointer, *seData->error);
+                }
+                break;
+            }
+            // תΪһѭ
+            if (*pointer < static_cast<size_t>(pointer_num)) {
+                recordHotness();
+                // ȫתָڼָʱָתָʱĴλϢתĿ
+                const auto jump_target = *pointer;
+                *pointer = pointer_num;
+                state.budget.safepoint();
+                *pointer = jump_target;
+            }
+            *pointer += 1;
+        }
+        return resultStatus;
+    }
+
     ExecutionStatus InsSet::execute() {
+        auto &state = ExecutionState::current();
         // µǰĹĿ¼
-        base::PROGRAM_WORKING_DIRECTORY_STACK.push(utils::getFileDirFromPath(this->scope_leader_file));
-        scope_name_stack.push(data_space_pool.getCurrentScopeNoLock()->getName());
-        const std::string &ext_name = insSet.empty() ? "" : (insSet[0]->ext.empty() ? "" : insSet[0]->ext);
-        const auto &ext_scope = loadinExtension(ext_name);
-        exe_stack.push(this);
+        base::getProgramWorkingDirectoryStack().push(utils::getFileDirFromPath(this->scope_leader_file));
+        scope_name_stack.push(data_space_pool().getCurrentScopeNoLock()->getName());
+        const auto &ext_scope = loadinExtension();
+        state.exe_stack.push(this);
         ExecutionStatus resultStatus{};
         const auto pointer = std::make_shared<size_t>(0);
         pointers.push(pointer);
+        recordHotness();
         try {
-            while (*pointer < insSet.size()) {
-                const int &pointer_num = *pointer;
-                if (debug_mode != DebugMode::None && break_points.contains(insSet[pointer_num]->pos.getLine())){
-                    debug_mode = DebugMode::Standard;
-                }
-                if (debug_mode == DebugMode::Standard || debug_mode == DebugMode::NormalSkip) {
-                    debug_process(insSet[pointer_num]);
-                }
-                resultStatus = insSet[pointer_num]->execute(*pointer);
-                if (resultStatus == ExecutionStatus::Aborted || resultStatus == ExecutionStatus::AbortedLoop
-                    || resultStatus == ExecutionStatus::AbortedFunction) {
-                    break;
-                }
-                if (resultStatus == ExecutionStatus::ExposedError)
-                {
-                    if (const auto &se = data_space_pool.findDataByIDNoLock(_SE_SpaceID);
-                        se && se->getTypeID().fullEqualWith(data::Error::typeId)) {
-                        const auto &seData = static_pointer_cast<data::Error>(se);
-                        handleError(pointer, *seData->error);
-                    }
-                    break;
+            // ָѭãתΪִаȫ
+            if (!insSet.empty()) {
+                state.budget.safepoint();
+            }
+            // δʱģʽڼ䲻ı䣬ֱѡòԼִѭ
+            if (state.debug_mode == DebugMode::None) {
+                resultStatus = run<false>(pointer);
+            } else {
+                if (breakpoint_epoch != state.breakpoints.getEpoch()) {
+                    state.breakpoints.patch(*this);
                 }
-                *pointer += 1;
+                resultStatus = run<true>(pointer);
             }
         } catch (base::RVM_Error &e) {
             const auto &error_pos = insSet[*pointer]->pos;
-            if (file_record.empty()) {
-                file_record = error_pos.getFilepath();
+            if (state.file_record.empty()) {
+                state.file_record = error_pos.getFilepath();
             }
             handleError(pointer, e);
             throw;
         }
-        exe_stack.pop();
+        state.exe_stack.pop();
         pointers.pop();
         scope_name_stack.pop();
-        if (exe_stack.empty()) {
-            io->flushOutputCache();
+        if (state.exe_stack.empty()) {
+            io()->flushOutputCache();
             if (resultStatus == ExecutionStatus::ExposedError) {
-                if (const auto se = data_space_pool.findDataByIDNoLock(_SE_SpaceID);
+                if (const auto se = data_space_pool().findDataByIDNoLock(state.se_space_id);
                     se && se->getTypeID().fullEqualWith(data::Error::typeId)) {
                     throw *std::static_pointer_cast<data::Error>(se)->error;
                 }
                 throw base::errors::ExposedError(unknown_, unknown_, {});
             }
-            if (debug_mode != DebugMode::None) {
-                debug_mode = DebugMode::Standard;
+            if (state.debug_mode != DebugMode::None) {
+                state.debug_mode = DebugMode::Standard;
                 debug_process(nullptr);
-                io->immediateOutput(
+                io()->immediateOutput(
                     ">> ",
                     cc::colorfulText("Process has finished without any errors.",
                         cc::TextColor::GREEN, {cc::Decoration::BOLD}));
             }
         }
         // ָϲ㹤Ŀ¼
-        base::PROGRAM_WORKING_DIRECTORY_STACK.pop();
+        base::getProgramWorkingDirectoryStack().pop();
         unloadExtension(ext_scope);
         return resultStatus;
     }
@@ -724,7 +1221,7 @@ namespace core::components {
         insSet.clear();
         insSet.reserve(insSetSize);
         for (size_t i = 0; i < insSetSize; ++i) {
-            auto ins = std::make_shared<Ins>();
+            auto ins = ProgramArena::make<Ins>();
             ins->deserialize(is, profile);
             insSet.push_back(ins);
         }
@@ -749,114 +1246,150 @@ namespace core::components {
 }
 
 namespace ris {
-    const RI S_M{"s-m", 0, exes::ri_flag};
-    const RI S_L{"s-l", 0, exes::ri_flag};
-    const RI S_F{"s-f", 0, exes::ri_flag};
-    const RI S_N{"s-n", 0, exes::ri_flag};
-    const RI S_UNPACK{"s-unpack", 0, exes::ri_flag};
-    const RI RG{"RG", 0, exes::ri_flag};
-    const RI RGE{"RGE", 0, exes::ri_flag};
-    const RI RNE{"RNE", 0, exes::ri_flag};
-    const RI RE{"RE", 0, exes::ri_flag};
-    const RI RLE{"RLE", 0, exes::ri_flag};
-    const RI RL{"RL", 0, exes::ri_flag};
-    const RI RT{"RT", 0, exes::ri_flag};
-    const RI RF{"RF", 0, exes::ri_flag};
-    const RI AND{"AND", 0, exes::ri_flag};
-    const RI OR{"OR", 0, exes::ri_flag};
+    constinit const RI S_M{"s-m", 0, exes::ri_flag};
+    constinit const RI S_L{"s-l", 0, exes::ri_flag};
+    constinit const RI S_F{"s-f", 0, exes::ri_flag};
+    constinit const RI S_N{"s-n", 0, exes::ri_flag};
+    constinit const RI S_UNPACK{"s-unpack", 0, exes::ri_flag};
+    constinit const RI RG{"RG", 0, exes::ri_flag};
+    constinit const RI RGE{"RGE", 0, exes::ri_flag};
+    constinit const RI RNE{"RNE", 0, exes::ri_flag};
+    constinit const RI RE{"RE", 0, exes::ri_flag};
+    constinit const RI RLE{"RLE", 0, exes::ri_flag};
+    constinit const RI RL{"RL", 0, exes::ri_flag};
+    constinit const RI RT{"RT", 0, exes::ri_flag};
+    constinit const RI RF{"RF", 0, exes::ri_flag};
+    constinit const RI AND{"AND", 0, exes::ri_flag};
+    constinit const RI OR{"OR", 0, exes::ri_flag};
 
     // ʵӰָ
-    const RI PASS{"PASS", -1, exes::ri_pass};
-    const RI UNKNOWN{"UNKNOWN", -1, exes::ri_unknown};
-    const RI BREAKPOINT{"BREAKPOINT", -1, exes::ri_breakpoint};
+    constinit const RI PASS{"PASS", -1, exes::ri_pass};
+    constinit const RI UNKNOWN{"UNKNOWN", -1, exes::ri_unknown};
+    constinit const RI BREAKPOINT{"BREAKPOINT", -1, exes::ri_breakpoint};
 
     // ʵӰָ
-    const RI ALLOT{"ALLOT", -1, exes::ri_allot};
-    const RI DELETE{"Delete", -1, exes::ri_delete};
-    const RI PUT{"PUT", 2, exes::ri_put};
-    const RI COPY{"COPY", 2, exes::ri_copy};
-    const RI ADD{"ADD", 3, exes::ri_add};
-    const RI OPP{"OPP", 2, exes::ri_opp};
-    const RI REPEAT{"REPEAT", -1, exes::ri_repeat, true, true}; // repeat ָѭִָظָֻɽ 1/2 
-    const RI END{"END", -1, exes::ri_end};
-    const RI FUNC{"FUNC", -1, exes::ri_func, true}; // func ָ庯ɽܶ
-    const RI FUNI{"FUNI", -1, exes::ri_funi, true}; // funi ָ庯ɽܶ
-    const RI CALL{"CALL", -1, exes::ri_call}; // call ָúɽܶ޷ֵĵ
-    const RI IVOK{"IVOK", -1, exes::ri_ivok}; // ivok ָúɽܶзֵĵ
-    const RI UNTIL{"UNTIL", 2, exes::ri_until, true, true}; // until ָѭִָֱΪ
-    const RI EXIT{"EXIT", -1, exes::ri_exit}; // exit ָ˳ֲ
-    const RI SOUT{"SOUT", -1, exes::ri_sout}; // sout ָַɽܶ
-    const RI SIN{"SIN", -1, exes::ri_sin}; // sin ָַɽܶ
-    const RI FILE_GET{"FILE_GET", 3, exes::ri_file_get};
-    const RI FILE_READ{"FILE_READ", 2, exes::ri_file_read};
-    const RI FILE_WRITE{"FILE_WRITE", 2, exes::ri_file_write};
-    const RI FILE_GET_PATH{"FILE_GET_PATH", 2, exes::ri_file_get_path};
-    const RI FILE_GET_MODE{"FILE_GET_MODE", 2, exes::ri_file_get_mode};
-    const RI FILE_GET_SIZE{"FILE_GET_SIZE", 2, exes::ri_file_get_size};
-    const RI FILE_SET_MODE{"FILE_SET_MODE", 2, exes::ri_file_set_mode};
-    const RI FILE_SET_PATH{"FILE_SET_PATH", 2, exes::ri_file_set_path};
-    const RI CMP{"CMP", 3, exes::ri_cmp};
-    const RI CREL{"CREL", 3, exes::ri_crel};
-    const RI SET{"SET", 1, exes::ri_pass};
-    const RI JMP{"JMP", 1, exes::ri_jmp};
-    const RI JR{"JR", 3, exes::ri_jr};
-    const RI JT{"JT", 2, exes::ri_jt};
-    const RI JF{"JF", 2, exes::ri_jf};
-    const RI MUL{"MUL", 3, exes::ri_mul};
-    const RI ITER_APND{"ITER_APND", -1, exes::ri_iter_apnd};
-    const RI ITER_SUB{"ITER_SUB", 4, exes::ri_iter_sub};
-    const RI ITER_SIZE{"ITER_SIZE", 2, exes::ri_iter_size};
-    const RI ITER_GET{"ITER_GET", 3, exes::ri_iter_get};
-    const RI ITER_TRAV{"ITER_TRAV", 3, exes::ri_iter_trav, true,
+    constinit const RI ALLOT{"ALLOT", -1, exes::ri_allot};
+    constinit const RI DELETE{"Delete", -1, exes::ri_delete};
+    constinit const RI PUT{"PUT", 2, exes::ri_put, false, false, exes::ri_put_unchecked};
+    constinit const RI COPY{"COPY", 2, exes::ri_copy, false, false, exes::ri_copy_unchecked};
+    constinit const RI ADD{"ADD", 3, exes::ri_add, false, false, exes::ri_add_unchecked};
+    constinit const RI OPP{"OPP", 2, exes::ri_opp, false, false, exes::ri_opp_unchecked};
+    constinit const RI REPEAT{"REPEAT", -1, exes::ri_repeat, true, true}; // repeat ָѭִָظָֻɽ 1/2 
+    constinit const RI END{"END", -1, exes::ri_end};
+    constinit const RI FUNC{"FUNC", -1, exes::ri_func, true, false, exes::ri_func_unchecked}; // func ָ庯ɽܶ
+    constinit const RI FUNI{"FUNI", -1, exes::ri_funi, true, false, exes::ri_funi_unchecked}; // funi ָ庯ɽܶ
+    constinit const RI CALL{"CALL", -1, exes::ri_call}; // call ָúɽܶ޷ֵĵ
+    constinit const RI IVOK{"IVOK", -1, exes::ri_ivok}; // ivok ָúɽܶзֵĵ
+    constinit const RI UNTIL{"UNTIL", 2, exes::ri_until, true, true}; // until ָѭִָֱΪ
+    constinit const RI EXIT{"EXIT", -1, exes::ri_exit}; // exit ָ˳ֲ
+    constinit const RI SOUT{"SOUT", -1, exes::ri_sout}; // sout ָַɽܶ
+    constinit const RI SIN{"SIN", -1, exes::ri_sin}; // sin ָַɽܶ
+    constinit const RI FILE_GET{"FILE_GET", 3, exes::ri_file_get};
+    constinit const RI FILE_READ{"FILE_READ", 2, exes::ri_file_read};
+    constinit const RI FILE_WRITE{"FILE_WRITE", 2, exes::ri_file_write};
+    constinit const RI FILE_GET_PATH{"FILE_GET_PATH", 2, exes::ri_file_get_path};
+    constinit const RI FILE_GET_MODE{"FILE_GET_MODE", 2, exes::ri_file_get_mode};
+    constinit const RI FILE_GET_SIZE{"FILE_GET_SIZE", 2, exes::ri_file_get_size};
+    constinit const RI FILE_SET_MODE{"FILE_SET_MODE", 2, exes::ri_file_set_mode};
+    constinit const RI FILE_SET_PATH{"FILE_SET_PATH", 2, exes::ri_file_set_path};
+    constinit const RI CMP{"CMP", 3, exes::ri_cmp, false, false, exes::ri_cmp_unchecked};
+    constinit const RI CREL{"CREL", 3, exes::ri_crel};
+    constinit const RI CMPJ{"CMPJ", 4, exes::ri_cmpj, false, false, exes::ri_cmpj_unchecked}; // cmpj ָȽϵʱתɱȽ
+    constinit const RI SET{"SET", 1, exes::ri_pass};
+    constinit const RI JMP{"JMP", 1, exes::ri_jmp, false, false, exes::ri_jmp_unchecked};
+    constinit const RI JR{"JR", 3, exes::ri_jr, false, false, exes::ri_jr_unchecked};
+    constinit const RI JT{"JT", 2, exes::ri_jt, false, false, exes::ri_jt_unchecked};
+    constinit const RI JF{"JF", 2, exes::ri_jf, false, false, exes::ri_jf_unchecked};
+    constinit const RI MUL{"MUL", 3, exes::ri_mul, false, false, exes::ri_mul_unchecked};
+    constinit const RI ITER_APND{"ITER_APND", -1, exes::ri_iter_apnd};
+    constinit const RI ITER_SUB{"ITER_SUB", 4, exes::ri_iter_sub};
+    constinit const RI ITER_SIZE{"ITER_SIZE", 2, exes::ri_iter_size, false, false, exes::ri_iter_size_unchecked};
+    constinit const RI ITER_GET{"ITER_GET", 3, exes::ri_iter_get, false, false, exes::ri_iter_get_unchecked};
+    constinit const RI ITER_TRAV{"ITER_TRAV", 3, exes::ri_iter_trav, true,
                        true}; // iter_trav ָarg1arg2洢Ԫأarg3洢
-    const RI ITER_REV_TRAV{"ITER_REV_TRAV", 3, exes::ri_iter_rev_trav, true,
+    constinit const RI ITER_REV_TRAV{"ITER_REV_TRAV", 3, exes::ri_iter_rev_trav, true,
                        true}; // iter_rev_trav ָarg1arg2洢Ԫأarg3洢
-    const RI ITER_SET{"ITER_SET", 3,
+    constinit const RI ITER_SET{"ITER_SET", 3,
                       exes::ri_iter_set}; // iter_trav ָarg1arg2洢Ԫأarg3洢
-    const RI ITER_DEL{"ITER_DEL", -1, exes::ri_iter_del};
-    const RI ITER_INSERT{"ITER_INSERT", 3, exes::ri_iter_insert};
-    const RI ITER_UNPACK{"ITER_UNPACK", -1, exes::ri_iter_unpack};
-    const RI RAND_INT{"RAND_INT", 3, exes::ri_rand_int}; // rand_int ָɽarg1Сֵarg2ֵarg3洢
-    const RI RAND_FLOAT{"RAND_FLOAT", 4, exes::ri_rand_float}; // rand_float ָɽarg1Сֵarg2ֵarg3洢
-    const RI LOADIN{"LOADIN", -1, exes::ri_loadin};
-    const RI LINK{"LINK", -1, exes::ri_link};
-    const RI EXT_GET{"EXT_GET", 3, exes::ri_ext_get};
-    const RI EXE_RASM{"EXE_RASM", -1, exes::ri_exe_rasm};
-    const RI TP_GET{"TP_GET", 2, exes::ri_tp_get};
-    const RI DIV{"DIV", 3, exes::ri_div};
-    const RI POW{"POW", 3, exes::ri_pow};
-    const RI ROOT{"ROOT", 3, exes::ri_root};
-    const RI MOD{"MOD", 3, exes::ri_mod};
-    const RI TP_SET{"TP_SET", 2, exes::ri_tp_set};
-    const RI TP_DEF{"TP_DEF", -1, exes::ri_tp_def};
-    const RI TP_NEW{"TP_NEW", 2, exes::ri_tp_new};
-    const RI TP_ADD_INST_FIELD{"TP_ADD_INST_FIELD", -1, exes::ri_tp_add_inst_field};
-    const RI TP_ADD_TP_FIELD{"TP_ADD_TP_FIELD", -1, exes::ri_tp_add_tp_field};
-    const RI TP_SET_FIELD{"TP_SET_FIELD", 3, exes::ri_tp_set_field};
-    const RI TP_GET_FIELD{"TP_GET_FIELD", 3, exes::ri_tp_get_field};
-    const RI TP_GET_SUPER_FIELD{"TP_GET_SUPER_FIELD", 4, exes::ri_tp_get_super_field};
-    const RI TP_DERIVE{"TP_DERIVE", 2, exes::ri_tp_derive};
-    const RI SP_SET{"SP_SET", 1, exes::ri_sp_set};
-    const RI SP_GET{"SP_GET", 1, exes::ri_sp_get};
-    const RI SP_NEW{"SP_NEW", 1, exes::ri_sp_new}; // sp_new ָһԶΪǰ򣬽һָID洢
-    const RI SP_DEL{"SP_DEL", 1, exes::ri_sp_del}; // sp_del ָͷָ򣬽һ
-    const RI QOT{"QOT", 2, exes::ri_qot}; // qot ָָݵID洢Уɽ
-    const RI QOT_VAL{"QOT_VAL", 2, exes::ri_qot_val};
-    const RI EXPOSE{"EXPOSE", 1, exes::ri_expose};
-    const RI ATMP{"ATMP", 0, exes::ri_atmp, true};
-    const RI DETECT{"DETECT", 2, exes::ri_flag, true};
-    const RI RET{"RET", -1, exes::ri_ret};
-    const RI PAIR_SET{"PAIR_SET", 3, exes::ri_pair_set};
-    const RI PAIR_SET_KEY{"PAIR_SET_KEY", 2, exes::ri_pair_set_key};
-    const RI PAIR_SET_VALUE{"PAIR_SET_VALUE", 2, exes::ri_pair_set_value};
-    const RI PAIR_GET_KEY{"PAIR_GET_KEY", 2, exes::ri_pair_get_key};
-    const RI PAIR_GET_VALUE{"PAIR_GET_VALUE", 2, exes::ri_pair_get_value};
-    const RI DICT_SET{"DICT_SET", 3, exes::ri_dict_set};
-    const RI DICT_GET{"DICT_GET", 3, exes::ri_dict_get};
-    const RI DICT_DEL{"DICT_DEL", -1, exes::ri_dict_del};
-    const RI DICT_KEYS{"DICT_KEYS", 2, exes::ri_dict_keys};
-    const RI DICT_VALUES{"DICT_VALUES", 2, exes::ri_dict_values};
+    constinit const RI ITER_DEL{"ITER_DEL", -1, exes::ri_iter_del};
+    constinit const RI ITER_INSERT{"ITER_INSERT", 3, exes::ri_iter_insert};
+    constinit const RI ITER_UNPACK{"ITER_UNPACK", -1, exes::ri_iter_unpack};
+    constinit const RI RAND_INT{"RAND_INT", 3, exes::ri_rand_int}; // rand_int ָɽarg1Сֵarg2ֵarg3洢
+    constinit const RI RAND_FLOAT{"RAND_FLOAT", 4, exes::ri_rand_float}; // rand_float ָɽarg1Сֵarg2ֵarg3洢
+    constinit const RI LOADIN{"LOADIN", -1, exes::ri_loadin};
+    constinit const RI LINK{"LINK", -1, exes::ri_link};
+    constinit const RI EXT_GET{"EXT_GET", 3, exes::ri_ext_get};
+    constinit const RI EXE_RASM{"EXE_RASM", -1, exes::ri_exe_rasm};
+    constinit const RI TP_GET{"TP_GET", 2, exes::ri_tp_get};
+    constinit const RI DIV{"DIV", 3, exes::ri_div, false, false, exes::ri_div_unchecked};
+    constinit const RI POW{"POW", 3, exes::ri_pow, false, false, exes::ri_pow_unchecked};
+    constinit const RI ROOT{"ROOT", 3, exes::ri_root, false, false, exes::ri_root_unchecked};
+    constinit const RI MOD{"MOD", 3, exes::ri_mod, false, false, exes::ri_mod_unchecked};
+    constinit const RI TP_SET{"TP_SET", 2, exes::ri_tp_set};
+    constinit const RI TP_DEF{"TP_DEF", -1, exes::ri_tp_def};
+    constinit const RI TP_NEW{"TP_NEW", 2, exes::ri_tp_new};
+    constinit const RI TP_ADD_INST_FIELD{"TP_ADD_INST_FIELD", -1, exes::ri_tp_add_inst_field};
+    constinit const RI TP_ADD_TP_FIELD{"TP_ADD_TP_FIELD", -1, exes::ri_tp_add_tp_field};
+    constinit const RI TP_SET_FIELD{"TP_SET_FIELD", 3, exes::ri_tp_set_field};
+    constinit const RI TP_GET_FIELD{"TP_GET_FIELD", 3, exes::ri_tp_get_field};
+    constinit const RI TP_GET_SUPER_FIELD{"TP_GET_SUPER_FIELD", 4, exes::ri_tp_get_super_field};
+    constinit const RI TP_DERIVE{"TP_DERIVE", 2, exes::ri_tp_derive};
+    constinit const RI SP_SET{"SP_SET", 1, exes::ri_sp_set};
+    constinit const RI SP_GET{"SP_GET", 1, exes::ri_sp_get};
+    constinit const RI SP_NEW{"SP_NEW", 1, exes::ri_sp_new}; // sp_new ָһԶΪǰ򣬽һָID洢
+    constinit const RI SP_DEL{"SP_DEL", 1, exes::ri_sp_del}; // sp_del ָͷָ򣬽һ
+    constinit const RI QOT{"QOT", 2, exes::ri_qot}; // qot ָָݵID洢Уɽ
+    constinit const RI QOT_VAL{"QOT_VAL", 2, exes::ri_qot_val};
+    constinit const RI EXPOSE{"EXPOSE", 1, exes::ri_expose};
+    constinit const RI ATMP{"ATMP", 0, exes::ri_atmp, true};
+    constinit const RI DETECT{"DETECT", 2, exes::ri_flag, true};
+    constinit const RI RET{"RET", -1, exes::ri_ret};
+    constinit const RI MEMO{"MEMO", -1, exes::ri_memo}; // memo ָзֵΪɽ 1/2 arg1arg2
+    constinit const RI MEMO_CLR{"MEMO_CLR", 1, exes::ri_memo_clr}; // memo_clr ָմĽ
+    constinit const RI LIST_LIT{"LIST_LIT", -1, exes::ri_list_lit}; // list_lit ָԪشбһΪĿ
+    constinit const RI DICT_LIT{"DICT_LIT", -1, exes::ri_dict_lit}; // dict_lit ָԽеֵֵ䣬һΪĿ
+    constinit const RI PAIR_SET{"PAIR_SET", 3, exes::ri_pair_set};
+    constinit const RI PAIR_SET_KEY{"PAIR_SET_KEY", 2, exes::ri_pair_set_key};
+    constinit const RI PAIR_SET_VALUE{"PAIR_SET_VALUE", 2, exes::ri_pair_set_value};
+    constinit const RI PAIR_GET_KEY{"PAIR_GET_KEY", 2, exes::ri_pair_get_key};
+    constinit const RI PAIR_GET_VALUE{"PAIR_GET_VALUE", 2, exes::ri_pair_get_value};
+    constinit const RI DICT_SET{"DICT_SET", 3, exes::ri_dict_set};
+    constinit const RI DICT_GET{"DICT_GET", 3, exes::ri_dict_get};
+    constinit const RI DICT_DEL{"DICT_DEL", -1, exes::ri_dict_del};
+    constinit const RI DICT_KEYS{"DICT_KEYS", 2, exes::ri_dict_keys};
+    constinit const RI DICT_VALUES{"DICT_VALUES", 2, exes::ri_dict_values};
     // ToDo: ӵָ
+
+    // ָϷָƱһ
+    // ָڱе±д RSI ļָֻ׷ӵĩβ
+    constexpr RITable riTable{{{
+            {"s-m", &S_M}, {"s-l", &S_L}, {"s-f", &S_F}, {"s-n", &S_N}, {"s-unpack", &S_UNPACK}, {"RG", &RG},
+            {"RGE", &RGE}, {"RNE", &RNE}, {"RE", &RE}, {"RLE", &RLE}, {"RL", &RL}, {"RT", &RT}, {"RF", &RF},
+            {"AND", &AND}, {"OR", &OR}, {"PASS", &PASS}, {"UNKNOWN", &UNKNOWN}, {"BREAKPOINT", &BREAKPOINT},
+            {"ALLOT", &ALLOT}, {"Delete", &DELETE}, {"PUT", &PUT}, {"COPY", &COPY}, {"ADD", &ADD}, {"OPP", &OPP},
+            {"REPEAT", &REPEAT}, {"END", &END}, {"FUNC", &FUNC}, {"FUNI", &FUNI}, {"CALL", &CALL}, {"IVOK", &IVOK},
+            {"UNTIL", &UNTIL}, {"EXIT", &EXIT}, {"SOUT", &SOUT}, {"SIN", &SIN}, {"FILE_GET", &FILE_GET},
+            {"FILE_READ", &FILE_READ}, {"FILE_WRITE", &FILE_WRITE}, {"FILE_GET_PATH", &FILE_GET_PATH},
+            {"FILE_GET_MODE", &FILE_GET_MODE}, {"FILE_GET_SIZE", &FILE_GET_SIZE}, {"FILE_SET_MODE", &FILE_SET_MODE},
+            {"FILE_SET_PATH", &FILE_SET_PATH}, {"CMP", &CMP}, {"CREL", &CREL}, {"SET", &SET}, {"JMP", &JMP},
+            {"JR", &JR}, {"JT", &JT}, {"JF", &JF}, {"MUL", &MUL}, {"ITER_APND", &ITER_APND},
+            {"ITER_SUB", &ITER_SUB}, {"ITER_SIZE", &ITER_SIZE}, {"ITER_GET", &ITER_GET}, {"ITER_TRAV", &ITER_TRAV},
+            {"ITER_REV_TRAV", &ITER_REV_TRAV}, {"ITER_SET", &ITER_SET}, {"ITER_DEL", &ITER_DEL},
+            {"ITER_INSERT", &ITER_INSERT}, {"ITER_UNPACK", &ITER_UNPACK}, {"RAND_INT", &RAND_INT},
+            {"RAND_FLOAT", &RAND_FLOAT}, {"LOADIN", &LOADIN}, {"LINK", &LINK}, {"EXT_GET", &EXT_GET},
+            {"EXE_RASM", &EXE_RASM}, {"TP_GET", &TP_GET}, {"DIV", &DIV}, {"POW", &POW}, {"ROOT", &ROOT},
+            {"MOD", &MOD}, {"TP_SET", &TP_SET}, {"TP_DEF", &TP_DEF}, {"TP_NEW", &TP_NEW},
+            {"TP_ADD_INST_FIELD", &TP_ADD_INST_FIELD}, {"TP_ADD_TP_FIELD", &TP_ADD_TP_FIELD},
+            {"TP_SET_FIELD", &TP_SET_FIELD}, {"TP_GET_FIELD", &TP_GET_FIELD},
+            {"TP_GET_SUPER_FIELD", &TP_GET_SUPER_FIELD}, {"TP_DERIVE", &TP_DERIVE}, {"SP_SET", &SP_SET},
+            {"SP_GET", &SP_GET}, {"SP_NEW", &SP_NEW}, {"SP_DEL", &SP_DEL}, {"QOT", &QOT}, {"QOT_VAL", &QOT_VAL},
+            {"EXPOSE", &EXPOSE}, {"ATMP", &ATMP}, {"DETECT", &DETECT}, {"RET", &RET}, {"PAIR_SET", &PAIR_SET},
+            {"PAIR_SET_KEY", &PAIR_SET_KEY}, {"PAIR_SET_VALUE", &PAIR_SET_VALUE}, {"PAIR_GET_KEY", &PAIR_GET_KEY},
+            {"PAIR_GET_VALUE", &PAIR_GET_VALUE}, {"DICT_SET", &DICT_SET}, {"DICT_GET", &DICT_GET},
+            {"DICT_DEL", &DICT_DEL}, {"DICT_KEYS", &DICT_KEYS}, {"DICT_VALUES", &DICT_VALUES},
+            {"CMPJ", &CMPJ}, {"MEMO", &MEMO}, {"MEMO_CLR", &MEMO_CLR}, {"LIST_LIT", &LIST_LIT},
+            {"DICT_LIT", &DICT_LIT},
+    }}};
 }
 
 namespace core::data {
@@ -977,7 +1510,7 @@ namespace tools {
         switch (arg.getType()) {
             case utils::ArgType::keyword:
             case utils::ArgType::identifier: {
-                auto [dataID, data] = data_space_pool.findDataByNameNoLock(arg.getValue());
+                auto [dataID, data] = data_space_pool().findDataByNameNoLock(arg.getSymbol());
                 if (!data) {
                     return nullptr; //  nullptr ʾҲ
                 }
@@ -1052,13 +1585,18 @@ namespace tools {
     }
 
     std::pair<bool, std::string> checkExtensionExist(const std::string &file_path) {
-        const auto &path = utils::getAbsolutePath(file_path);
-        return {memory::loadedExtensions.contains(path),
+        // 淶· .. ӣʹͬһļĲͬдӦͬһչ
+        std::error_code ec;
+        auto path = std::filesystem::weakly_canonical(utils::getAbsolutePath(file_path), ec).string();
+        if (ec) {
+            path = utils::getAbsolutePath(file_path);
+        }
+        return {data_space_pool().loaded_extensions.contains(path),
                 path};
     }
 
     bool checkExtensionExistStrict(const std::string &file_path) {
-        return  memory::loadedExtensions.contains(file_path);
+        return  data_space_pool().loaded_extensions.contains(file_path);
     }
 
     void processQuotedData(std::shared_ptr<base::RVM_Data> &data) {
@@ -1076,7 +1614,7 @@ namespace tools {
             const std::string instructionName = ins.ri->toString();
             throw base::errors::DataTypeMismatchError(
                     arg.getPosStr(),
-                    ins.raw_code,
+                    ins.rawCode(),
                     {
                             "The target data type of argument " + std::to_string(argIndex) +
                             " of " + instructionName + " must be " + expectedTypeName + ".",
@@ -1103,7 +1641,7 @@ namespace tools {
         // ָǷЧ
         if (!arg_data) {
             throw base::errors::DataTypeMismatchError(
-                arg.getPosStr(), ins.raw_code,
+                arg.getPosStr(), ins.rawCode(),
                 {"Argument at position " + std::to_string(argIndex) + " is null."},
                 {"Ensure the argument at position " + std::to_string(argIndex) + " is properly initialized."}
             );
@@ -1132,7 +1670,7 @@ namespace tools {
 
             // ׳Ͳƥ쳣
             throw base::errors::DataTypeMismatchError(
-                arg.getPosStr(), ins.raw_code,
+                arg.getPosStr(), ins.rawCode(),
                 {"Argument at position " + std::to_string(argIndex) + " of " + ins.ri->toString() +
                  " has incorrect type. Expected: " + allowedTypesStr +
                  ", got: " + actualTypeId.toString() + "."},
@@ -1158,7 +1696,7 @@ namespace tools {
             }
             const std::string instructionName = ins.ri->toString();
             throw base::errors::ArgTypeMismatchError(
-                arg.getPosStr(), ins.raw_code, {
+                arg.getPosStr(), ins.rawCode(), {
                     "The target arg type of argument " + std::to_string(argIndex) +
                     " of " + instructionName + " must be " + expectedTypeName + ".",
                     "Error arg: " + arg.toString(),
@@ -1176,7 +1714,7 @@ namespace tools {
                                                const std::shared_ptr<base::RVM_Data> check_data) {
         if (!check_data->getTypeID().fullEqualWith(T::typeId)){
             throw base::errors::DataTypeMismatchError(
-                    check_arg.getPosStr(), ins.raw_code,
+                    check_arg.getPosStr(), ins.rawCode(),
                     {"The type of the target argument of the " + ins.ri->toString() +
                      " must be " + T::typeId.toString() + "."},
                     {"Check whether the target data of the " + ins.ri->toString() +
@@ -1187,6 +1725,293 @@ namespace tools {
 
 }
 
+// ָ̬У
+namespace core::components {
+
+    // ͹index Ϊ -1 ʱȫ
+    struct OperandRule {
+        int index;
+        std::unordered_set<utils::ArgType> allowed;
+    };
+
+    // ɱָĲΧmax Ϊ -1 ʱ
+    struct ArityRange {
+        int min;
+        int max;
+    };
+
+    void InsSet::verify(const bool &trusted) {
+        verifyScope(nullptr, trusted);
+    }
+
+    void InsSet::verifyScope(const RI *leader_ri, const bool &trusted) {
+        if (is_verified) {
+            return;
+        }
+        // Ӧִָкеľ̬鱣һ£ִкЩѾ
+        static const std::unordered_map<const RI *, std::vector<OperandRule>> operand_rules{
+            {&ris::ALLOT, {{-1, {utils::ArgType::identifier}}}},
+            {&ris::DELETE, {{-1, {utils::ArgType::identifier}}}},
+            {&ris::PUT, {{1, {utils::ArgType::identifier, utils::ArgType::keyword}}}},
+            {&ris::COPY, {{1, {utils::ArgType::identifier, utils::ArgType::keyword}}}},
+            {&ris::ADD, {{2, {utils::ArgType::identifier, utils::ArgType::keyword}}}},
+            {&ris::MUL, {{2, {utils::ArgType::identifier}}}},
+            {&ris::DIV, {{2, {utils::ArgType::identifier, utils::ArgType::keyword}}}},
+            {&ris::POW, {{2, {utils::ArgType::identifier, utils::ArgType::keyword}}}},
+            {&ris::ROOT, {{2, {utils::ArgType::identifier, utils::ArgType::keyword}}}},
+            {&ris::MOD, {{2, {utils::ArgType::identifier, utils::ArgType::keyword}}}},
+            {&ris::OPP, {{1, {utils::ArgType::identifier, utils::ArgType::keyword}}}},
+            {&ris::ITER_SIZE, {{1, {utils::ArgType::identifier, utils::ArgType::keyword}}}},
+            {&ris::ITER_GET, {{2, {utils::ArgType::identifier, utils::ArgType::keyword}}}},
+            {&ris::CMP, {{2, {utils::ArgType::identifier, utils::ArgType::keyword}}}},
+            {&ris::CMPJ, {{2, {utils::ArgType::keyword}},
+                          {3, {utils::ArgType::identifier}}}},
+            {&ris::FUNC, {{0, {utils::ArgType::identifier}}}},
+            {&ris::FUNI, {{0, {utils::ArgType::identifier}}}},
+            {&ris::JR, {{0, {utils::ArgType::identifier, utils::ArgType::keyword}},
+                        {1, {utils::ArgType::keyword}},
+                        {2, {utils::ArgType::identifier}}}},
+            {&ris::DETECT, {{0, {utils::ArgType::identifier, utils::ArgType::keyword}}}},
+            {&ris::MEMO, {{0, {utils::ArgType::identifier, utils::ArgType::keyword}}}},
+            {&ris::MEMO_CLR, {{0, {utils::ArgType::identifier, utils::ArgType::keyword}}}},
+        };
+        static const std::unordered_map<const RI *, ArityRange> arity_ranges{
+            {&ris::END, {0, 1}},
+            {&ris::EXIT, {0, 1}},
+            {&ris::RET, {0, 1}},
+            {&ris::REPEAT, {1, 2}},
+            {&ris::LOADIN, {1, 2}},
+            {&ris::TP_DEF, {1, 2}},
+            {&ris::TP_ADD_TP_FIELD, {2, 3}},
+            {&ris::TP_ADD_INST_FIELD, {2, 3}},
+            {&ris::FUNC, {1, -1}},
+            {&ris::FUNI, {1, -1}},
+            {&ris::CALL, {1, -1}},
+            {&ris::IVOK, {2, -1}},
+            {&ris::ITER_APND, {2, -1}},
+            {&ris::ITER_DEL, {2, -1}},
+            {&ris::DICT_DEL, {1, -1}},
+            {&ris::MEMO, {1, 2}},
+            {&ris::LIST_LIT, {1, -1}},
+            {&ris::DICT_LIT, {1, -1}},
+        };
+        // תָбǩλ
+        static const std::unordered_map<const RI *, size_t> label_arg_indexes{
+            {&ris::JMP, 0},
+            {&ris::JR, 2},
+            {&ris::JT, 1},
+            {&ris::JF, 1},
+            {&ris::CMPJ, 3},
+        };
+        // ATMP ָᱻΪµָеתǩڲָֺн
+        const bool is_atmp_scope = leader_ri && ris::ATMP.equalWith(leader_ri);
+
+        for (size_t i = 0; i < insSet.size(); ++i) {
+            const auto &ins = insSet[i];
+            const auto &ri = ins->ri;
+            const auto &arg_size = static_cast<int>(ins->args.size());
+
+            // ڼʱǼ飺ִкֱӰ±ʲ
+            // ʹļͷΪУ飬𻵻α RSI ļҲԽʣtrusted ﷨ṹתǩļ
+
+            // 
+            if (ri->arity != -1 && arg_size != ri->arity) {
+                throw base::errors::ArgumentNumberError(ins->pos.toString(), ins->rawCode(),
+                                                        std::to_string(ri->arity), arg_size,
+                                                        ri->toString(), {});
+            }
+            if (const auto &it = arity_ranges.find(ri);
+                it != arity_ranges.end() &&
+                (arg_size < it->second.min || (it->second.max != -1 && arg_size > it->second.max))) {
+                const auto &[min, max] = it->second;
+                throw base::errors::ArgumentNumberError(
+                        ins->pos.toString(), ins->rawCode(),
+                        max == -1 ? std::to_string(min) + "+" :
+                        min == max ? std::to_string(min) : std::to_string(min) + " / " + std::to_string(max),
+                        arg_size, ri->toString(), {});
+            }
+
+            // 
+            if (const auto &it = operand_rules.find(ri);
+                it != operand_rules.end()) {
+                for (const auto &[index, allowed]: it->second) {
+                    if (index == -1) {
+                        for (int j = 0; j < arg_size; ++j) {
+                            tools::checkArgumentType(*ins, ins->args[j], j + 1, allowed);
+                        }
+                    } else if (index < arg_size) {
+                        tools::checkArgumentType(*ins, ins->args[index], index + 1, allowed);
+                    }
+                }
+            }
+
+            // Ƕ
+            if (ri->hasScope) {
+                if (!ins->scopeInsSet() || ins->scopeInsSet()->insSet.empty() ||
+                    !ris::END.equalWith(ins->scopeInsSet()->insSet.back()->ri)) {
+                    throw base::RVM_Error(base::ErrorType::SyntaxError, ins->pos.toString(), ins->rawCode(),
+                                          {"This error is caused by a scope that is not closed.",
+                                           "Unclosed Scope: " + ri->toString()},
+                                          {"Use the " + ris::END.toString() +
+                                           " to close the scope opened by the " + ri->toString() + "."});
+                }
+            } else if (ins->scopeInsSet() && !ins->scopeInsSet()->insSet.empty()) {
+                throw base::RVM_Error(base::ErrorType::SyntaxError, ins->pos.toString(), ins->rawCode(),
+                                      {"This error is caused by an instruction without a scope "
+                                       "containing nested instructions.",
+                                       "Error RI: " + ri->toString()},
+                                      {"Check whether the instructions are nested under the correct scope."});
+            }
+
+            if (!trusted) {
+                if (ris::DETECT.equalWith(ri) && !is_atmp_scope) {
+                    throw base::RVM_Error(base::ErrorType::SyntaxError, ins->pos.toString(), ins->rawCode(),
+                                          {"This error is caused by using the " + ris::DETECT.toString() +
+                                           " outside the scope of the " + ris::ATMP.toString() + "."},
+                                          {"The " + ris::DETECT.toString() + " can only be used directly "
+                                           "inside the scope of the " + ris::ATMP.toString() + "."});
+                }
+                if (ris::END.equalWith(ri) && (leader_ri == nullptr || i != insSet.size() - 1)) {
+                    throw base::RVM_Error(base::ErrorType::SyntaxError, ins->pos.toString(), ins->rawCode(),
+                                          {"This error is caused by an " + ris::END.toString() +
+                                           " without a matching scope."},
+                                          {"Check whether each " + ris::END.toString() +
+                                           " closes exactly one scope."});
+                }
+            }
+
+            // תǩ
+            ins->label_pointer = -1;
+            bool bindable = true;
+            if (const auto &it = label_arg_indexes.find(ri);
+                it != label_arg_indexes.end()) {
+                if (it->second >= ins->args.size()) {
+                    ins->executor = ri->executor;
+                    continue;
+                }
+                const auto &label_arg = ins->args[it->second];
+                ins->label_pointer = getLabel(label_arg.getValue());
+                if (ins->label_pointer == -1) {
+                    if (!trusted) {
+                        throw base::RVM_Error(base::ErrorType::SyntaxError, label_arg.getPosStr(), ins->rawCode(),
+                                              {"This error is caused by jumping to a label that is not defined "
+                                               "in the current scope.",
+                                               "Undefined Label: " + label_arg.toString()},
+                                              {"Use the " + ris::SET.toString() +
+                                               " to define the label in the same scope as the jump instruction."});
+                    }
+                    bindable = false;
+                }
+                bindable = bindable && !is_atmp_scope;
+            }
+
+            // ִк
+            ins->executor = bindable && ri->uncheckedExecutor ? ri->uncheckedExecutor : ri->executor;
+
+            if (ri->hasScope && ins->scopeInsSet()) {
+                ins->scopeInsSet()->verifyScope(ri, trusted);
+            }
+
+            // ԤȲ ATMP 򣬲ָֺ½еתǩ
+            if (ris::ATMP.equalWith(ri) && ins->scopeInsSet() && !ins->cached<AtmpLayout>()) {
+                const auto &atmp_layout = ins->cached<AtmpLayout>() = AtmpLayout::split(*ins);
+                atmp_layout->attempt_ins_set->verifyScope(nullptr, true);
+                atmp_layout->finally_ins_set->verifyScope(nullptr, true);
+            }
+
+            if (ris::EXT_GET.equalWith(ri) && !ins->cached<ExtFieldCache>()) {
+                ins->cached<ExtFieldCache>() = ExtFieldCache::build(*ins);
+            }
+        }
+        is_verified = true;
+    }
+
+}
+
+// ֲִ
+namespace core::components {
+
+    void TypeFeedback::recordOperand(const size_t &index, const base::IDType &type) {
+        if (index >= MAX_OPERANDS) {
+            return;
+        }
+        switch (operand_states[index]) {
+            case State::Uninitialized:
+                operand_types[index] = type;
+                operand_states[index] = State::Monomorphic;
+                break;
+            case State::Monomorphic:
+                if (operand_types[index] != type) {
+                    operand_states[index] = State::Polymorphic;
+                }
+                break;
+            case State::Polymorphic:
+                break;
+        }
+    }
+
+    void TypeFeedback::recordCallTarget(const base::RVM_Data *target) {
+        switch (call_target_state) {
+            case State::Uninitialized:
+                call_target = target;
+                call_target_state = State::Monomorphic;
+                break;
+            case State::Monomorphic:
+                if (call_target != target) {
+                    call_target = nullptr;
+                    call_target_state = State::Polymorphic;
+                }
+                break;
+            case State::Polymorphic:
+                break;
+        }
+    }
+
+    bool TypeFeedback::isMonomorphic(const size_t &index, const base::IDType &type) const {
+        return index < MAX_OPERANDS && operand_states[index] == State::Monomorphic && operand_types[index] == type;
+    }
+
+    void TypeFeedback::reset() {
+        operand_types = {};
+        operand_states = {};
+        call_target = nullptr;
+        call_target_state = State::Uninitialized;
+    }
+
+    // ػִкϾΪ̬ʱ滻Ӧִָк
+    struct QuickenedVariant {
+        base::IDType left;
+        base::IDType right;
+        ExecutorFunc executor;
+    };
+
+    void InsSet::tierUp() {
+        static const std::unordered_map<const RI *, std::vector<QuickenedVariant>> quickened_variants{
+            {&ris::ADD, {{base::IDType::Int, base::IDType::Int, exes::ri_add_int_int},
+                         {base::IDType::Float, base::IDType::Float, exes::ri_add_float_float}}},
+            {&ris::MUL, {{base::IDType::Int, base::IDType::Int, exes::ri_mul_int_int},
+                         {base::IDType::Float, base::IDType::Float, exes::ri_mul_float_float}}},
+        };
+        for (const auto &ins: insSet) {
+            // ֻػѰִкָػȥŻָ
+            if (ins->executor != ins->ri->uncheckedExecutor) {
+                continue;
+            }
+            const auto &it = quickened_variants.find(ins->ri);
+            if (it == quickened_variants.end() || ins->feedback().deopt_count >= TypeFeedback::MAX_DEOPT_COUNT) {
+                continue;
+            }
+            for (const auto &[left, right, executor]: it->second) {
+                if (ins->feedback().isMonomorphic(0, left) && ins->feedback().isMonomorphic(1, right)) {
+                    ins->executor = executor;
+                    break;
+                }
+            }
+        }
+    }
+
+}
+
 // ִָк
 namespace exes {
 
@@ -1206,10 +2031,10 @@ namespace exes {
     }
 
     ExecutionStatus ri_breakpoint(const Ins &ins, size_t &pointer, const StdArgs &args) {
-        if (InsSet::debug_mode != DebugMode::None) {
-            io->immediateOutputError("[Breakpoint]\n");
-            InsSet::debug_mode = DebugMode::Standard;
-            InsSet::debug_process(std::make_shared<Ins>(ins));
+        if (ExecutionState::current().debug_mode != DebugMode::None) {
+            io()->immediateOutputError("[Breakpoint]\n");
+            ExecutionState::current().debug_mode = DebugMode::Standard;
+            InsSet::debug_process(nullptr);
         }
         return ExecutionStatus::Success;
     }
@@ -1218,7 +2043,7 @@ namespace exes {
     ExecutionStatus ri_allot(const Ins &ins, size_t &pointer, const StdArgs &args) {
         for (const auto &arg: args) {
             if (arg.getType() != utils::ArgType::identifier) {
-                throw base::errors::ArgTypeMismatchError(arg.getPosStr(), ins.raw_code,
+                throw base::errors::ArgTypeMismatchError(arg.getPosStr(), ins.rawCode(),
                                                       {"Error Arg: " + arg.toString(),
                                                        "Target Type: " +
                                                        utils::getTypeFormatString(utils::ArgType::identifier)},
@@ -1229,14 +2054,14 @@ namespace exes {
                 return ExecutionStatus::FailedWithError;
             }
             try {
-                data_space_pool.addData(arg.getValue(), std::make_shared<data::Null>(data::Null()));
+                data_space_pool().addData(arg.getValue(), std::make_shared<data::Null>(data::Null()));
             } catch (const base::errors::DuplicateKeyError &_) {
                 throw base::errors::DuplicateKeyError(
-                        arg.getPos().toString(), ins.raw_code,
+                        arg.getPos().toString(), ins.rawCode(),
                         {"Error Arg: " + arg.toString(),
                          "Exist Space: " +
                          utils::getSpaceFormatString(arg.getValue(),
-                                                     data_space_pool.findDataByNameNoLock(
+                                                     data_space_pool().findDataByNameNoLock(
                                                              arg.getValue()).second->toString())},
                         {"Please use a different name for the variable."});
             }
@@ -1251,7 +2076,7 @@ namespace exes {
             for (const auto &arg: args) {
                 error_arg = arg;
                 if (arg.getType() != utils::ArgType::identifier) {
-                    throw base::errors::ArgTypeMismatchError(arg.getPos().toString(), ins.raw_code,
+                    throw base::errors::ArgTypeMismatchError(arg.getPos().toString(), ins.rawCode(),
                                                           {"The type of the target argument of the " +
                                                            ins.ri->toString() +
                                                            " cannot be " + getTypeFormatString(arg.getType()) + ".",
@@ -1261,10 +2086,10 @@ namespace exes {
                                                            getTypeFormatString(utils::ArgType::identifier) + "."});
                     return ExecutionStatus::FailedWithError;
                 }
-                data_space_pool.removeDataByNameNoLock(arg.getValue());
+                data_space_pool().removeDataByNameNoLock(arg.getValue());
             }
         } catch (const base::errors::MemoryError &_) {
-            throw base::errors::MemoryError(error_arg.getPos().toString(), ins.raw_code,
+            throw base::errors::MemoryError(error_arg.getPos().toString(), ins.rawCode(),
                                             {"This error is caused by deleting memory space that does not exist.",
                                              "Nonexistent Space Name: " + error_arg.toString()},
                                             {"If this memory space is necessary, allocate it manually "
@@ -1281,38 +2106,43 @@ namespace exes {
         if (is_copy) {
             if (const auto copied_data = source_data->copy_ptr();
                 !target_data->updateData(copied_data)){
-                data_space_pool.updateDataByNameNoLock(target_data_name, copied_data);
+                data_space_pool().updateDataByNameNoLock(target_data_name, copied_data);
             }
         } else {
             if (!target_data->updateData(source_data)){
-                data_space_pool.updateDataByNameNoLock(target_data_name, source_data);
+                data_space_pool().updateDataByNameNoLock(target_data_name, source_data);
             }
         }
         return ExecutionStatus::Success;
     }
 
     ExecutionStatus ri_put(const Ins &ins, size_t &pointer, const StdArgs &args) {
+        if (const auto &arg2 = args[1];
+            arg2.getType() == utils::ArgType::number || arg2.getType() == utils::ArgType::string) {
+            throw base::errors::ArgTypeMismatchError(arg2.getPos().toString(), ins.rawCode(),
+                                                  {"The type of the target argument of the " +
+                                                   ins.ri->toString() +
+                                                   " cannot be an immutable argument type.",
+                                                   "Error Arg: " + arg2.toString()},
+                                                  {"Check whether the target data of the " + ins.ri->toString() +
+                                                   " instruction is of mutable type.",
+                                                   "Mutable argument types include, but are not limited to 'identifier', 'keyword'."});
+        }
+        return ri_put_unchecked(ins, pointer, args);
+    }
+
+    ExecutionStatus ri_put_unchecked(const Ins &ins, [[maybe_unused]] size_t &pointer, const StdArgs &args) {
         auto error_arg = args[1];
         try {
             const auto &arg1 = args[0];
             const auto &arg2 = args[1];
-            if (arg2.getType() == utils::ArgType::number || arg2.getType() == utils::ArgType::string) {
-                throw base::errors::ArgTypeMismatchError(arg2.getPos().toString(), ins.raw_code,
-                                                      {"The type of the target argument of the " +
-                                                       ins.ri->toString() +
-                                                       " cannot be an immutable argument type.",
-                                                       "Error Arg: " + arg2.toString()},
-                                                      {"Check whether the target data of the " + ins.ri->toString() +
-                                                       " instruction is of mutable type.",
-                                                       "Mutable argument types include, but are not limited to 'identifier', 'keyword'."});
-            }
             error_arg = arg1;
             const auto &source_data = tools::getArgOriginData(arg1);
             error_arg = arg2;
             const auto &target_data = tools::getArgOriginData(arg2);
             return mov(source_data, target_data, arg2.getValue(), !tools::isIterableData(source_data->getTypeID()));
         } catch (const base::errors::MemoryError &_) {
-            throw base::errors::MemoryError(error_arg.getPos().toString(), ins.raw_code,
+            throw base::errors::MemoryError(error_arg.getPos().toString(), ins.rawCode(),
                                             {"This error is caused by accessing memory space that does not exist.",
                                              "Nonexistent Space Name: " + error_arg.toString()},
                                             {"Use the " + ris::ALLOT.toString() +
@@ -1322,25 +2152,29 @@ namespace exes {
     }
 
     ExecutionStatus ri_copy(const Ins &ins, size_t &pointer, const StdArgs &args) {
+        if (args[1].getType() == utils::ArgType::number || args[1].getType() == utils::ArgType::string) {
+            throw base::errors::ArgTypeMismatchError(args[1].getPos().toString(), ins.rawCode(),
+                                                  {"The type of the target argument of the " +
+                                                   ins.ri->toString() +
+                                                   " cannot be an immutable argument type.",
+                                                   "Error Arg: " + args[1].toString()},
+                                                  {"Check whether the target data of the " + ins.ri->toString() +
+                                                   " instruction is of mutable type.",
+                                                   "Mutable argument types include, but are not limited to 'identifier', 'keyword'."});
+        }
+        return ri_copy_unchecked(ins, pointer, args);
+    }
+
+    ExecutionStatus ri_copy_unchecked(const Ins &ins, [[maybe_unused]] size_t &pointer, const StdArgs &args) {
         auto error_arg = args[1];
         try {
-            if (args[1].getType() == utils::ArgType::number || args[1].getType() == utils::ArgType::string) {
-                throw base::errors::ArgTypeMismatchError(args[1].getPos().toString(), ins.raw_code,
-                                                      {"The type of the target argument of the " +
-                                                       ins.ri->toString() +
-                                                       " cannot be an immutable argument type.",
-                                                       "Error Arg: " + args[1].toString()},
-                                                      {"Check whether the target data of the " + ins.ri->toString() +
-                                                       " instruction is of mutable type.",
-                                                       "Mutable argument types include, but are not limited to 'identifier', 'keyword'."});
-            }
             error_arg = args[0];
             const auto &source_data = tools::getArgOriginData(args[0]);
             error_arg = args[1];
             const auto &target_data = tools::getArgOriginData(args[1]);
             return mov(source_data, target_data, args[1].getValue(), true);
         } catch (const base::errors::MemoryError &_) {
-            throw base::errors::MemoryError(error_arg.getPos().toString(), ins.raw_code,
+            throw base::errors::MemoryError(error_arg.getPos().toString(), ins.rawCode(),
                                             {"This error is caused by accessing memory space that does not exist.",
                                              "Nonexistent Space Name: " + error_arg.toString()},
                                             {"Use the " + ris::ALLOT.toString() +
@@ -1352,16 +2186,92 @@ namespace exes {
     ExecutionStatus ri_add(const Ins &ins, size_t &pointer, const StdArgs &args)
     {
         tools::checkArgumentType(ins, args[2], 3, {utils::ArgType::identifier, utils::ArgType::keyword});
+        return ri_add_unchecked(ins, pointer, args);
+    }
 
+    // ԭдĿݣĿΪͬʱֱ޸ֵΪ¶
+    // ƸʱͻֵƽĿԭдͬһݵλÿɼԲ
+    template <typename T, typename V>
+    bool storeArithmeticResultInPlace(const utils::Symbol target_symbol, const V &value) {
+        if (const auto &target = data_space_pool().findUpdateTargetNoLock(target_symbol);
+            target && target->getTypeID().fullEqualWith(T::typeId)) {
+            std::static_pointer_cast<T>(target)->setValue(value);
+            return true;
+        }
+        return false;
+    }
+
+    struct AlwaysInPlace {
+        bool operator()(const auto &, const auto &) const { return true; }
+    };
+
+    // ͬΪ Int ͬΪ Float ʱֱӰͼ㣬ԭдĿ
+    // guard  false ʱԭд룺ΪҪȡֵ仯 Int ʱ Numeric 㺯
+    template <typename Op, typename Guard = AlwaysInPlace>
+    bool executeArithmeticInPlace(const utils::Symbol target_symbol, const std::shared_ptr<base::RVM_Data> &left,
+                                  const std::shared_ptr<base::RVM_Data> &right, Op op, Guard guard = {}) {
+        const auto &left_type = left->getTypeID();
+        if (!left_type.fullEqualWith(right->getTypeID())) {
+            return false;
+        }
+        if (left_type.fullEqualWith(data::Int::typeId)) {
+            const auto left_value = std::static_pointer_cast<data::Int>(left)->getValue();
+            const auto right_value = std::static_pointer_cast<data::Int>(right)->getValue();
+            return guard(left_value, right_value) &&
+                   storeArithmeticResultInPlace<data::Int>(target_symbol, op(left_value, right_value));
+        }
+        if (left_type.fullEqualWith(data::Float::typeId)) {
+            const auto left_value = std::static_pointer_cast<data::Float>(left)->getValue();
+            const auto right_value = std::static_pointer_cast<data::Float>(right)->getValue();
+            return guard(left_value, right_value) &&
+                   storeArithmeticResultInPlace<data::Float>(target_symbol, op(left_value, right_value));
+        }
+        return false;
+    }
+
+    // ͬ͵Int Float 벻Ϊ Numeric::divide  Int
+    struct DivisionKeepsType {
+        template <typename T>
+        bool operator()(const T &left, const T &right) const {
+            if (right == 0) {
+                return false;
+            }
+            if constexpr (std::is_integral_v<T>) {
+                return left % right == 0;
+            } else {
+                return left / right != std::floor(left / right);
+            }
+        }
+    };
+
+    struct NonZeroDivisor {
+        bool operator()(const auto &, const auto &right) const { return right != 0; }
+    };
+
+    struct Modulo {
+        template <typename T>
+        T operator()(const T &left, const T &right) const {
+            if constexpr (std::is_integral_v<T>) {
+                return left % right;
+            } else {
+                return std::fmod(left, right);
+            }
+        }
+    };
+
+    ExecutionStatus ri_add_unchecked(const Ins &ins, [[maybe_unused]] size_t &pointer, const StdArgs &args)
+    {
         auto [data1, data2] = [&args, &ins]() -> std::pair<std::shared_ptr<base::RVM_Data>, std::shared_ptr<base::RVM_Data>> {
             int index = 0;
             try {
-                const auto d1 = tools::processQuoteData(tools::getArgNewData(args[0]));
+                const auto raw1 = tools::getArgNewData(args[0]);
+                ins.feedback().recordOperand(0, raw1->getTypeID().idType);
                 index = 1;
-                const auto d2 = tools::processQuoteData(tools::getArgNewData(args[1]));
-                return {d1, d2};
+                const auto raw2 = tools::getArgNewData(args[1]);
+                ins.feedback().recordOperand(1, raw2->getTypeID().idType);
+                return {tools::processQuoteData(raw1), tools::processQuoteData(raw2)};
             } catch (const base::errors::MemoryError &_) {
-                throw base::errors::MemoryError(args[index].getPosStr(), ins.raw_code,
+                throw base::errors::MemoryError(args[index].getPosStr(), ins.rawCode(),
                                                 {"This error is caused by accessing memory space that does not exist.",
                                                  "Nonexistent Space Name: " + args[index].toString()},
                                                 {"Use the " + ris::ALLOT.toString() +
@@ -1402,7 +2312,7 @@ namespace exes {
                     const auto &error_data = (!numeric1 ? data1 : data2);
                     throw base::errors::ArgTypeMismatchError(
                             (error_arg.getPosStr()),
-                            ins.raw_code,
+                            ins.rawCode(),
                             {"Error Arg: " + utils::getSpaceFormatString(error_arg.getValue(), error_data->toString()),
                              "Target Data Type: " + data::Numeric::typeId.toString() + " or " + data::Iterable::typeId.toString()},
                             {"The " + ins.ri->toString() + " requires that "
@@ -1412,31 +2322,37 @@ namespace exes {
                 }
 
                 // Numericͣʹadd
+                if (executeArithmeticInPlace(args[2].getSymbol(), data1, data2, std::plus())) {
+                    return ExecutionStatus::Success;
+                }
                 result = numeric1->add(numeric2);
             }
-            data_space_pool.updateDataByNameNoLock(args[2].getValue(), result);
+            data_space_pool().updateDataByNameNoLock(args[2].getSymbol(), result);
         } catch (const base::errors::MemoryError &_) {
-            throw base::errors::MemoryError(args[2].getPosStr(), ins.raw_code,
+            throw base::errors::MemoryError(args[2].getPosStr(), ins.rawCode(),
                                             {"This error is caused by accessing memory space that does not exist.",
                                              "Nonexistent Space Name: " + args[2].toString()},
                                             {"Use the " + ris::ALLOT.toString() +
                                              " to manually allocate a named memory space before accessing it."});
         } catch (base::errors::DataTypeMismatchError &e)
         {
-            e.error_line = ins.raw_code;
+            e.error_line = ins.rawCode();
             throw;
         }
         return ExecutionStatus::Success;
     }
 
     ExecutionStatus ri_opp(const Ins &ins, size_t &pointer, const StdArgs &args) {
-        const auto &arg1 = args[0];
-        const auto &arg2 = args[1];
-        if (arg2.getType() == utils::ArgType::number || arg2.getType() == utils::ArgType::string) {
+        if (args[1].getType() == utils::ArgType::number || args[1].getType() == utils::ArgType::string) {
             throw std::runtime_error(
-                    "Invalid argument: " + arg2.toString() + ". Third argument must be an identifier.");
-            return ExecutionStatus::FailedWithError;
+                    "Invalid argument: " + args[1].toString() + ". Third argument must be an identifier.");
         }
+        return ri_opp_unchecked(ins, pointer, args);
+    }
+
+    ExecutionStatus ri_opp_unchecked(const Ins &ins, [[maybe_unused]] size_t &pointer, const StdArgs &args) {
+        const auto &arg1 = args[0];
+        const auto &arg2 = args[1];
         std::shared_ptr<base::RVM_Data> data1 = tools::getArgNewData(arg1);
         std::shared_ptr<base::RVM_Data> result;
         if (data1->getTypeID() == data::Int::typeId || data1->getTypeID() == data::Float::typeId ||
@@ -1448,7 +2364,7 @@ namespace exes {
             throw std::runtime_error("Invalid argument types for addition: " + data1->getTypeID().toString());
             return ExecutionStatus::FailedWithError;
         }
-        data_space_pool.updateDataByNameNoLock(arg2.getValue(), result);
+        data_space_pool().updateDataByNameNoLock(arg2.getSymbol(), result);
         return ExecutionStatus::Success;
     }
 
@@ -1461,7 +2377,7 @@ namespace exes {
         int repeat_times = 0;
         std::shared_ptr<base::RVM_Data> repeated_index = nullptr;
         if (args.size() == 2 && args[1].getValue() != "_") {
-            data_space_pool.updateDataByNameNoLock(args[1].getValue(), std::make_shared<data::Int>(0));
+            data_space_pool().updateDataByNameNoLock(args[1].getSymbol(), std::make_shared<data::Int>(0));
             repeated_index = tools::getArgOriginData(args[1]);
         }
         if (arg1.getType() == utils::ArgType::string) {
@@ -1475,13 +2391,13 @@ namespace exes {
             throw std::runtime_error("Invalid argument type: " + value1->getTypeID().toString());
             return ExecutionStatus::FailedWithError;
         }
-        const auto &repeatScope = data_space_pool.acquireScope(pre_REPEAT);
+        const auto &repeatScope = data_space_pool().acquireScope(pre_REPEAT);
         ExecutionStatus result = ExecutionStatus::Success;
         for (int i = 0; i < repeat_times; i++) {
             if (repeated_index && !repeated_index->updateData(std::make_shared<data::Int>(i))){
                 throw std::runtime_error("Invalid argument type: " + repeated_index->getTypeID().toString());
             }
-            if (const auto &insResult = ins.scopeInsSet->execute();
+            if (const auto &insResult = ins.scopeInsSet()->execute();
                 insResult == ExecutionStatus::Aborted) {
                 break;
             } else if (insResult > ExecutionStatus::Aborted)
@@ -1490,16 +2406,16 @@ namespace exes {
                 break;
             }
         }
-        data_space_pool.releaseScopeNoLock(repeatScope);
+        data_space_pool().releaseScopeNoLock(repeatScope);
         return result;
     }
 
     ExecutionStatus ri_end(const Ins &ins, size_t &pointer, const StdArgs &args) {
-        data_space_pool.setCurrentScopeByName(InsSet::exe_stack.top()->scope_name_stack.top());
+        data_space_pool().setCurrentScopeByName(ExecutionState::current().exe_stack.top()->scope_name_stack.top());
         if (ins.is_delayed_release_scope) {
-            data_space_pool.getCurrentScopeNoLock()->clear();
+            data_space_pool().getCurrentScopeNoLock()->clear();
         } else {
-            data_space_pool.releaseScopeNoLock(data_space_pool.getCurrentScopeNoLock());
+            data_space_pool().releaseScopeNoLock(data_space_pool().getCurrentScopeNoLock());
         }
         return ExecutionStatus::Success;
     }
@@ -1508,13 +2424,17 @@ namespace exes {
         if (args[0].getType() != utils::ArgType::identifier) {
             throw std::runtime_error("Invalid argument type: " + args[0].toString());
         }
+        return ri_func_unchecked(ins, pointer, args);
+    }
+
+    ExecutionStatus ri_func_unchecked(const Ins &ins, [[maybe_unused]] size_t &pointer, const StdArgs &args) {
         const auto &func_name = args[0].getValue();
         // ʹ emplace ֱй󣬱Ŀƶ
-        data_space_pool.addData(func_name,
+        data_space_pool().addData(func_name,
                                 std::make_shared<data::Function>(func_name,
-                                                                       std::move(StdArgs{args.begin() + 1,
+                                                                       std::move(data::Callable::StdArgs{args.begin() + 1,
                                                                                          args.end()}),
-                                                                       ins.scopeInsSet));
+                                                                       ins.scopeInsSet()));
         return ExecutionStatus::Success;
     }
 
@@ -1522,25 +2442,50 @@ namespace exes {
         if (args[0].getType() != utils::ArgType::identifier) {
             throw std::runtime_error("Invalid argument type: " + args[0].toString());
         }
+        return ri_funi_unchecked(ins, pointer, args);
+    }
+
+    ExecutionStatus ri_funi_unchecked(const Ins &ins, [[maybe_unused]] size_t &pointer, const StdArgs &args) {
         const auto &func_name = args[0].getValue();
         // ʹ emplace ֱй󣬱Ŀƶ
-        data_space_pool.addData(func_name,
+        data_space_pool().addData(func_name,
                                 std::make_shared<data::RetFunction>(func_name,
-                                                                          std::move(StdArgs{args.begin() + 1,
+                                                                          std::move(data::Callable::StdArgs{args.begin() + 1,
                                                                                             args.end()}),
-                                                                          ins.scopeInsSet));
+                                                                          ins.scopeInsSet()));
         return ExecutionStatus::Success;
     }
 
+    // ýִ״̬õĺԼ RET 뷵ֵĴݣδʱΪ nullptr
+    struct CallResult {
+        ExecutionStatus status;
+        std::shared_ptr<base::RVM_Data> function;
+        std::shared_ptr<base::RVM_Data> return_value;
+    };
+
+    void writeCompatibleReturnValue(const std::shared_ptr<base::RVM_Data> &value) {
+        auto &state = ExecutionState::current();
+        data_space_pool().updateDataNoLock(state.sr_space_id, value);
+        state.sr_holds_return_value = true;
+    }
+
+    size_t fingerprintScopes(const std::vector<std::shared_ptr<memory::RVM_Scope>> &scopes) {
+        size_t result = scopes.size();
+        for (const auto &scope: scopes) {
+            result = result * 31 + scope->fingerprint();
+        }
+        return result;
+    }
+
     template<typename FuncType>
-    std::pair<ExecutionStatus, std::shared_ptr<base::RVM_Data>>
+    CallResult
     executeFunctionCall(const Ins &ins, size_t &pointer, const StdArgs &args,
                         const std::string &funcTypeName)
     {
         // һǷΪϷ
         static auto checkArgType = [&ins](const utils::Arg &arg) {
             if (arg.getType() != utils::ArgType::identifier && arg.getType() != utils::ArgType::keyword) {
-                throw base::errors::ArgTypeMismatchError(arg.getPosStr(), ins.raw_code,
+                throw base::errors::ArgTypeMismatchError(arg.getPosStr(), ins.rawCode(),
                                                       {"The target type of the first argument to the " +
                                                        ins.ri->toString() + " is " +
                                                        getTypeFormatString(utils::ArgType::identifier) +
@@ -1562,12 +2507,16 @@ namespace exes {
 
         std::shared_ptr<FuncType> function = nullptr;
         std::shared_ptr<memory::RVM_Scope> space = nullptr;
+        std::shared_ptr<MemoTable> memo_table = nullptr;
+        std::string memo_key{};
+        std::vector<std::shared_ptr<memory::RVM_Scope>> checked_scopes{};
+        size_t checked_fingerprint = 0;
 
         try {
             // Һ
-            auto [func_id, func] = data_space_pool.findDataByNameNoLock(func_name);
+            auto [func_id, func] = data_space_pool().findDataByNameNoLock(func_name);
             if (func == nullptr) {
-                throw base::RVM_Error(base::ErrorType::MemoryError, args[0].getPosStr(), ins.raw_code,
+                throw base::RVM_Error(base::ErrorType::MemoryError, args[0].getPosStr(), ins.rawCode(),
                                       {"This error is caused by the access memory space does not exist.",
                                        "Nonexistent Function Name: " + args[0].toString()},
                                       {"The function is defined using the " + ris::FUNC.toString() +
@@ -1575,7 +2524,7 @@ namespace exes {
             }
             tools::processQuotedData(func);
             if (!func->getTypeID().fullEqualWith(FuncType::typeId)) {
-                throw base::errors::DataTypeMismatchError(error_arg.getPosStr(), ins.raw_code,
+                throw base::errors::DataTypeMismatchError(error_arg.getPosStr(), ins.rawCode(),
                                                           {"The target type of the first argument to the " +
                                                               ins.ri->toString() +
                                                               " is " + FuncType::typeId.toString() + ", not " +
@@ -1589,6 +2538,7 @@ namespace exes {
             }
 
             function = std::static_pointer_cast<FuncType>(func);
+            ins.feedback().recordCallTarget(function.get());
 
             // 
             const size_t requiredArgCount = function->args.size();
@@ -1616,7 +2566,7 @@ namespace exes {
                 const std::string &call_str = is_ret_func ? "invoking" : "calling";
                 const std::string &call_upper_str = is_ret_func ? "Invoking" : "Calling";
                 throw base::RVM_Error(base::ErrorType::ArgumentError, args[args.size() - 1].getPosStr(),
-                                      ins.raw_code,
+                                      ins.rawCode(),
                                       {"This error is caused by a mismatch in the number of arguments passed in when "
                                        + call_str + " the function.",
                                        call_upper_str + " Function: " + function->toString(),
@@ -1626,38 +2576,81 @@ namespace exes {
                                                                                                "number of arguments defined by the function."});
             }
 
+            // лʱֱӷػݵĸִк
+            memo_table = function->func_body->memo_table;
+            if (memo_table) {
+                if (auto key = MemoTable::makeKey(arg_table, requiredArgCount)) {
+                    memo_key = std::move(*key);
+                    if (const auto &cached = memo_table->find(memo_key)) {
+                        return {ExecutionStatus::Success, function, cached->copy_ptr()};
+                    }
+                } else {
+                    // кзǻʱεüȲȡҲд뻺
+                    memo_table = nullptr;
+                }
+            }
+            if (memo_table && ExecutionState::current().memo_purity_check) {
+                checked_scopes = data_space_pool().getVisibleScopesNoLock();
+                checked_fingerprint = fingerprintScopes(checked_scopes);
+            }
+
             // 󶨲
-            space = data_space_pool.acquireScope(pre_FUNC + function->func_name);
+            space = data_space_pool().acquireScope(pre_FUNC + function->func_name);
             const auto &arg_size = args.size();
             for (size_t i = 0; i < requiredArgCount; ++i) {
                 error_arg = args[i + 1 < arg_size ? i + 1 : arg_size - 1];
                 space->addDataByName(function->args[i].getValue(), arg_table[i]);
             }
         } catch (const base::errors::MemoryError &) {
-            throw base::errors::MemoryError(error_arg.getPosStr(), ins.raw_code,
+            throw base::errors::MemoryError(error_arg.getPosStr(), ins.rawCode(),
                                             {"This error is caused by accessing memory space that does not exist.",
                                              "Nonexistent Space Name: " + error_arg.toString()},
                                             {"Use the " + ris::FUNC.toString() +
                                              " to defined a named function before calling it."});
         }
-        // ú
-        const auto &res = function->callSelf();
+        // úΪεѹ뷵ֵĴRET ֱ
+        auto &registers = ExecutionState::current().return_registers;
+        registers.emplace_back(nullptr);
+        ExecutionStatus res;
+        try {
+            res = function->callSelf();
+        } catch (...) {
+            registers.pop_back();
+            throw;
+        }
+        auto return_value = std::move(registers.back());
+        registers.pop_back();
         if (res == ExecutionStatus::AbortedFunction)
         {
-            data_space_pool.releaseScopeNoLock(space);
+            data_space_pool().releaseScopeNoLock(space);
         }
-        return {res, function};
+        if (memo_table && (res <= ExecutionStatus::Aborted || res == ExecutionStatus::AbortedFunction)) {
+            if (ExecutionState::current().memo_purity_check && fingerprintScopes(checked_scopes) != checked_fingerprint) {
+                throw base::RVM_Error(base::ErrorType::RuntimeError, ins.pos.toString(), ins.rawCode(),
+                                      {"This error is caused by a function marked as pure by the " +
+                                       ris::MEMO.toString() + " modifying data outside its own scope.",
+                                       "Impure Function: " + function->toString()},
+                                      {"Remove the " + ris::MEMO.toString() + " of the function, or make sure "
+                                       "that the function only modifies its local data."});
+            }
+            memo_table->store(memo_key, return_value ? return_value->copy_ptr() : data::nullInstance.copy_ptr());
+        }
+        return {res, function, std::move(return_value)};
     }
 
     ExecutionStatus ri_call(const Ins &ins, size_t &pointer, const StdArgs &args) {
-        executeFunctionCall<data::Function>(
-            ins, pointer, args, data::Function::typeId.toString());
+        // ޷ֵʱRET д SRͨ SR ȡֵĴ
+        if (const auto &[res, func, return_value] = executeFunctionCall<data::Function>(
+                ins, pointer, args, data::Function::typeId.toString());
+            return_value) {
+            writeCompatibleReturnValue(return_value);
+        }
         return ExecutionStatus::Success;
     }
 
     ExecutionStatus ri_ivok(const Ins &ins, size_t &pointer, const StdArgs &args) {
         if (args.size() < 2) {
-            throw base::RVM_Error(base::ErrorType::ArgumentError, args[0].getPosStr(), ins.raw_code,
+            throw base::RVM_Error(base::ErrorType::ArgumentError, args[0].getPosStr(), ins.rawCode(),
                                   {"This error is caused by a mismatch in the number of arguments passed in when invoking the func.",
                                    "Details: The " + ins.ri->toString() + " requires 2+ arguments, but " +
                                    std::to_string(args.size())
@@ -1669,7 +2662,7 @@ namespace exes {
         auto &ret_name_arg = args[args.size() - 1];
         if (ret_name_arg.getType() != utils::ArgType::identifier &&
             ret_name_arg.getType() != utils::ArgType::keyword) {
-            throw base::errors::ArgTypeMismatchError(ret_name_arg.getPosStr(), ins.raw_code,
+            throw base::errors::ArgTypeMismatchError(ret_name_arg.getPosStr(), ins.rawCode(),
                                                   {"The target type of the last argument to the " +
                                                    ins.ri->toString() +
                                                    " is " + getTypeFormatString(utils::ArgType::identifier) +
@@ -1684,18 +2677,23 @@ namespace exes {
                                                    + " or " + utils::getTypeFormatString(utils::ArgType::keyword) +
                                                    "."});
         }
-        auto [res, func] = executeFunctionCall<data::RetFunction>(ins, pointer, args,
-                                                                 data::RetFunction::typeId.toString());
+        auto [res, func, return_value] = executeFunctionCall<data::RetFunction>(
+                ins, pointer, args, data::RetFunction::typeId.toString());
         if (res > ExecutionStatus::Aborted && res != ExecutionStatus::AbortedFunction) {
             return res;
         }
         if (func && func->getTypeID() == data::RetFunction::typeId) {
             try {
-                data_space_pool.updateDataByNameNoLock(ret_name_arg.getValue(),
-                                                       data_space_pool.findDataByIDNoLock(SR_SpaceID)->copy_ptr());
-                data_space_pool.updateDataByIDNoLock(SR_SpaceID, data::nullInstance.copy_ptr());
+                //  RET ƺڼĴУֱĿ꣬ٴθ
+                data_space_pool().updateDataByNameNoLock(ret_name_arg.getSymbol(),
+                                                       return_value ? std::move(return_value)
+                                                                    : data::nullInstance.copy_ptr());
+                if (auto &state = ExecutionState::current(); state.sr_holds_return_value) {
+                    data_space_pool().updateDataByIDNoLock(state.sr_space_id, data::nullInstance.copy_ptr());
+                    state.sr_holds_return_value = false;
+                }
             } catch (const base::errors::MemoryError &) {
-                throw base::errors::MemoryError(ret_name_arg.getPosStr(), ins.raw_code,
+                throw base::errors::MemoryError(ret_name_arg.getPosStr(), ins.rawCode(),
                                                 {"This error is caused by accessing memory space that does not exist.",
                                                  "Nonexistent Space Name: " + ret_name_arg.toString()},
                                                 {"Use the " + ris::ALLOT.toString() +
@@ -1719,10 +2717,10 @@ namespace exes {
             throw std::runtime_error("Invalid argument type: " + args[1].toString());
         }
         const auto relation = base::stringToRelational(args[1].getValue());
-        const auto &until_scope = data_space_pool.acquireScope(pre_UNTIL);
+        const auto &until_scope = data_space_pool().acquireScope(pre_UNTIL);
         ExecutionStatus result = ExecutionStatus::Success;
         while (!compGroup->compare(relation)) {
-            if (const ExecutionStatus insResult = ins.scopeInsSet->execute();
+            if (const ExecutionStatus insResult = ins.scopeInsSet()->execute();
                 insResult == ExecutionStatus::Aborted)
             {
                 break;
@@ -1732,7 +2730,7 @@ namespace exes {
                 break;
             }
         }
-        data_space_pool.releaseScopeNoLock(until_scope);
+        data_space_pool().releaseScopeNoLock(until_scope);
         return result;
     }
 
@@ -1741,7 +2739,7 @@ namespace exes {
             throw std::runtime_error("Invalid argument number: " + std::to_string(args.size()));
         }
         const auto exit_label = args.size() == 1 ? args[0].getValue() : "";
-        const auto &top_ins_set = InsSet::exe_stack.top();
+        const auto &top_ins_set = ExecutionState::current().exe_stack.top();
         int end_pointer = top_ins_set->getLabel(top_ins_set->scope_prefix + exit_label + suf_END);
         if (end_pointer == -1) {
             end_pointer = top_ins_set->end_pointer;
@@ -1754,7 +2752,7 @@ namespace exes {
 
     ExecutionStatus ri_sout(const Ins &ins, size_t &pointer, const StdArgs &args) {
         if (args[0].getType() != utils::ArgType::keyword) {
-            throw base::RVM_Error(base::ErrorType::SyntaxError, args[0].getPos().toString(), ins.raw_code,
+            throw base::RVM_Error(base::ErrorType::SyntaxError, args[0].getPos().toString(), ins.rawCode(),
                                   {"This error was caused by using a parameter of the wrong type.",
                                    "Error Arg: " + args[0].toString(),
                                    "Expected Type: " + getTypeFormatString(utils::ArgType::keyword)},
@@ -1782,23 +2780,23 @@ namespace exes {
                 auto arg = args[error_pointer];
 
                 if (arg.getType() != utils::ArgType::keyword) {
-                    *io << tools::getArgOriginData(arg)->getValStr() << end_sign;
+                    *io() << tools::getArgOriginData(arg)->getValStr() << end_sign;
                     continue;
                 }
 
                 const auto inner_ri_opt = RI::getRIByStr(arg.getValue());
                 if (!inner_ri_opt) {
-                    *io << tools::getArgOriginData(arg)->getValStr() << end_sign;
+                    *io() << tools::getArgOriginData(arg)->getValStr() << end_sign;
                     continue;
                 }
 
                 if (const auto& inner_flag = inner_ri_opt;
                     ris::S_F.equalWith(inner_flag))
                 {
-                    io->flushOutputCache();
+                    io()->flushOutputCache();
                 } else if (ris::S_N.equalWith(inner_flag))
                 {
-                    *io << "\n";
+                    *io() << "\n";
                 } else if (ris::S_UNPACK.equalWith(inner_flag) && error_pointer + 1 < args.size())
                 {
                     arg = args[++error_pointer];
@@ -1808,19 +2806,19 @@ namespace exes {
                         const auto &iterData = std::static_pointer_cast<data::Iterable>(argData);
                         for (int i = 0; i < iterData->size(); i++)
                         {
-                            *io << iterData->getDataAt(i)->getValStr() << end_sign;
+                            *io() << iterData->getDataAt(i)->getValStr() << end_sign;
                         }
                     } else
                     {
-                        *io << argData->getValStr() << end_sign;
+                        *io() << argData->getValStr() << end_sign;
                     }
                 } else
                 {
-                    *io << tools::getArgOriginData(arg)->getValStr() << end_sign;
+                    *io() << tools::getArgOriginData(arg)->getValStr() << end_sign;
                 }
             }
         } catch (const base::errors::MemoryError &_) {
-            throw base::errors::MemoryError(args[error_pointer].getPosStr(), ins.raw_code,
+            throw base::errors::MemoryError(args[error_pointer].getPosStr(), ins.rawCode(),
                                             {"This error is caused by accessing memory space that does not exist.",
                                              "Nonexistent Space Name: " + args[error_pointer].toString()},
                                             {"Use the " + ris::ALLOT.toString() +
@@ -1830,13 +2828,13 @@ namespace exes {
     }
 
     ExecutionStatus ri_sin(const Ins &ins, size_t &pointer, const StdArgs &args) {
-        io->flushOutputCache();
+        io()->flushOutputCache();
         // ȼǷΪؼ
         if (args[0].getType() != utils::ArgType::keyword) {
             throw base::RVM_Error(
                     base::ErrorType::SyntaxError,
                     args[0].getPos().toString(),
-                    ins.raw_code,
+                    ins.rawCode(),
                     {"This error was caused by using an argument of the wrong type.",
                      "Error Arg: " + args[0].toString(),
                      "Expected Type: " + utils::getTypeFormatString(utils::ArgType::keyword)},
@@ -1853,7 +2851,7 @@ namespace exes {
             throw base::RVM_Error(
                     base::ErrorType::SyntaxError,
                     args[0].getPos().toString(),
-                    ins.raw_code,
+                    ins.rawCode(),
                     {"This error was caused by an invalid keyword argument value.",
                      "Error Arg: " + args[0].toString(),
                      "Failed to parse as a valid input mode keyword."},
@@ -1868,7 +2866,7 @@ namespace exes {
             throw base::RVM_Error(
                     base::ErrorType::SyntaxError,
                     args[0].getPos().toString(),
-                    ins.raw_code,
+                    ins.rawCode(),
                     {"This error was caused by using an unsupported keyword argument.",
                      "Error Arg: " + args[0].toString(),
                      "Expected RI: " + ris::S_L.toString() + " or " + ris::S_M.toString()},
@@ -1889,10 +2887,10 @@ namespace exes {
         };
         auto input_type = base::IODataType::String; // ĬΪַ
         auto updateData = [&input_type](const utils::Arg &arg) {
-            const auto &input_str = io->nextString();
+            const auto &input_str = io()->nextString();
             switch (input_type) {
                 case base::IODataType::String: {
-                    data_space_pool.updateDataByNameNoLock(arg.getValue(),
+                    data_space_pool().updateDataByNameNoLock(arg.getSymbol(),
                                                            std::make_shared<data::String>(input_str));
                     break;
                 }
@@ -1900,13 +2898,13 @@ namespace exes {
                     if (!utils::isNumber(input_str)) {
                         throw base::errors::ArgTypeMismatchError(unknown_, input_str, {}, {});
                     }
-                    data_space_pool.updateDataByNameNoLock(arg.getValue(),
+                    data_space_pool().updateDataByNameNoLock(arg.getSymbol(),
                                                            std::make_shared<data::Int>(
                                                                    utils::stringToInt(input_str)));
                     break;
                 }
                 case base::IODataType::Null: {
-                    data_space_pool.updateDataByNameNoLock(arg.getValue(),
+                    data_space_pool().updateDataByNameNoLock(arg.getSymbol(),
                                                            std::make_shared<data::Null>());
                     break;
                 }
@@ -1915,7 +2913,7 @@ namespace exes {
                         throw base::errors::ArgTypeMismatchError(unknown_, input_str, {}, {});
                     }
                     const auto &input_float = utils::stringToDouble(input_str);
-                    data_space_pool.updateDataByNameNoLock(arg.getValue(),
+                    data_space_pool().updateDataByNameNoLock(arg.getSymbol(),
                                                            std::make_shared<data::Float>(input_float));
                     break;
                 }
@@ -1923,7 +2921,7 @@ namespace exes {
                     if (!utils::isNumber(input_str)) {
                         throw base::errors::ArgTypeMismatchError(unknown_, input_str, {}, {});
                     }
-                    data_space_pool.updateDataByNameNoLock(arg.getValue(),
+                    data_space_pool().updateDataByNameNoLock(arg.getSymbol(),
                                                            std::make_shared<data::Char>(
                                                                    utils::stringToChar(input_str)));
                     break;
@@ -1932,7 +2930,7 @@ namespace exes {
                     if (!utils::isNumber(input_str)) {
                         throw base::errors::ArgTypeMismatchError(unknown_, input_str, {}, {});
                     }
-                    data_space_pool.updateDataByNameNoLock(arg.getValue(),
+                    data_space_pool().updateDataByNameNoLock(arg.getSymbol(),
                                                            std::make_shared<data::Bool>(
                                                                    utils::stringToBool(input_str)));
                     break;
@@ -1945,7 +2943,7 @@ namespace exes {
             switch (arg.getType()) {
                 case utils::ArgType::identifier: {
                     if (isInput) {
-                        io->readLineRaw();
+                        io()->readLineRaw();
                     }
                     updateData(arg);
                     break;
@@ -1953,7 +2951,7 @@ namespace exes {
                 case utils::ArgType::keyword: {
                     if (const auto opt = RI::getRIByStr(arg.getValue()); opt) {
                         if (const auto inner_flag = opt; ris::S_F.equalWith(inner_flag)) {
-                            io->flashInputCache();
+                            io()->flashInputCache();
                         } else {
                             throw std::runtime_error("Invalid argument type: " + arg.toString());
                         }
@@ -1977,9 +2975,9 @@ namespace exes {
         try {
             if (ris::S_L.equalWith(flag)) {
                 for (error_pointer = 1; error_pointer < args.size(); error_pointer++) {
-                    if (!io->hasNextString())
+                    if (!io()->hasNextString())
                     {
-                        io->readLineAndSplit();
+                        io()->readLineAndSplit();
                     }
                     inputData(args[error_pointer], false);
                 }
@@ -1989,13 +2987,13 @@ namespace exes {
                 }
             }
         } catch (const base::errors::MemoryError &_) {
-            throw base::errors::MemoryError(args[error_pointer].getPosStr(), ins.raw_code,
+            throw base::errors::MemoryError(args[error_pointer].getPosStr(), ins.rawCode(),
                                             {"This error is caused by accessing memory space that does not exist.",
                                              "Nonexistent Space Name: " + args[error_pointer].toString()},
                                             {"Use the " + ris::ALLOT.toString() +
                                              " to manually allocate a named memory space before accessing it."});
         } catch (const base::errors::ArgTypeMismatchError &error) {
-            throw base::errors::ArgTypeMismatchError(args[error_pointer].getPos().toString(), ins.raw_code,
+            throw base::errors::ArgTypeMismatchError(args[error_pointer].getPos().toString(), ins.rawCode(),
                                                   {"The input data type cannot be converted to the specified type.",
                                                    "Input Data: '" + error.error_line + "'",
                                                    "Data Receiver: " + args[error_pointer].toString(),
@@ -2021,11 +3019,11 @@ namespace exes {
             if (args[2].getType() != utils::ArgType::identifier && args[2].getType() != utils::ArgType::keyword) {
                 throw std::runtime_error("Invalid argument type: " + args[2].toString());
             }
-            data_space_pool.updateDataByNameNoLock(args[2].getValue(),
+            data_space_pool().updateDataByNameNoLock(args[2].getSymbol(),
                                                    std::make_shared<data::File>(filemode, filepath->getValStr()));
             return ExecutionStatus::Success;
         } catch (const base::errors::MemoryError &_) {
-            throw base::errors::MemoryError(error_arg.getPosStr(), ins.raw_code,
+            throw base::errors::MemoryError(error_arg.getPosStr(), ins.rawCode(),
                                             {"This error is caused by accessing memory space that does not exist.",
                                              "Nonexistent Space Name: " + error_arg.toString()},
                                             {"Use the " + ris::ALLOT.toString() +
@@ -2042,11 +3040,11 @@ namespace exes {
             throw std::runtime_error("Invalid argument type: " + args[1].toString());
         }
         try {
-            data_space_pool.updateDataByNameNoLock(args[1].getValue(),
+            data_space_pool().updateDataByNameNoLock(args[1].getSymbol(),
                                                    std::make_shared<data::String>(
                                                            static_pointer_cast<data::File>(filedata)->readFile()));
         } catch (const base::errors::FileReadError &_) {
-            throw base::errors::FileReadError(args[0].getPosStr(), ins.raw_code,
+            throw base::errors::FileReadError(args[0].getPosStr(), ins.rawCode(),
                                               {"This error is caused by reading a file that does not exist.",
                                                "File Name: " + utils::getSpaceFormatString(args[0].getValue(),
                                                                                            filedata->toString())},
@@ -2070,13 +3068,13 @@ namespace exes {
             if (file->writeFile(tools::getArgOriginData(args[0])->getValStr())) {
                 return ExecutionStatus::Success;
             } else {
-                throw base::errors::FileWriteError(args[0].getPos().toString(), ins.raw_code,
+                throw base::errors::FileWriteError(args[0].getPos().toString(), ins.rawCode(),
                                                    {"The file cannot be written.",
                                                     "Error File: " + file->toString()},
                                                    {"Ensure that the file exists and has write permission."});
             }
         } catch (const base::errors::MemoryError &_) {
-            throw base::errors::MemoryError(error_arg.getPosStr(), ins.raw_code,
+            throw base::errors::MemoryError(error_arg.getPosStr(), ins.rawCode(),
                                             {"This error is caused by accessing memory space that does not exist.",
                                              "Nonexistent Space Name: " + error_arg.toString()},
                                             {"Use the " + ris::ALLOT.toString() +
@@ -2098,11 +3096,11 @@ namespace exes {
             if (args[1].getType() != utils::ArgType::identifier && args[1].getType() != utils::ArgType::keyword) {
                 throw std::runtime_error("Invalid argument type: " + args[1].toString());
             }
-            data_space_pool.updateDataByNameNoLock(args[1].getValue(),
+            data_space_pool().updateDataByNameNoLock(args[1].getSymbol(),
                                                    std::make_shared<data::String>(
                                                            static_pointer_cast<data::File>(file)->filepath));
         } catch (const base::errors::MemoryError &_) {
-            throw base::errors::MemoryError(error_arg.getPosStr(), ins.raw_code,
+            throw base::errors::MemoryError(error_arg.getPosStr(), ins.rawCode(),
                                             {"This error is caused by accessing memory space that does not exist.",
                                              "Nonexistent Space Name: " + error_arg.toString()},
                                             {"Use the " + ris::ALLOT.toString() +
@@ -2123,14 +3121,14 @@ namespace exes {
                 throw std::runtime_error("Invalid argument type: " + args[0].toString());
             }
             error_arg = args[1];
-            data_space_pool.updateDataByNameNoLock(args[1].getValue(),
+            data_space_pool().updateDataByNameNoLock(args[1].getSymbol(),
                                                    std::make_shared<data::String>(
                                                            data::File::fileModeToString(
                                                                    static_pointer_cast<data::File>(
                                                                            file)->fileMode)));
             return ExecutionStatus::Success;
         } catch (const base::errors::MemoryError &_) {
-            throw base::errors::MemoryError(error_arg.getPosStr(), ins.raw_code,
+            throw base::errors::MemoryError(error_arg.getPosStr(), ins.rawCode(),
                                             {"This error is caused by accessing memory space that does not exist.",
                                              "Nonexistent Space Name: " + error_arg.toString()},
                                             {"Use the " + ris::ALLOT.toString() +
@@ -2163,7 +3161,7 @@ namespace exes {
 
 
     ExecutionStatus ri_jmp(const Ins &ins, size_t &pointer, const StdArgs &args) {
-        const auto &top_ins_set = InsSet::exe_stack.top();
+        const auto &top_ins_set = ExecutionState::current().exe_stack.top();
         const int &label = top_ins_set->getLabel(args[0].getValue());
         if (label == -1) {
             throw std::runtime_error("Invalid label: " + args[0].getValue());
@@ -2173,6 +3171,11 @@ namespace exes {
         return ExecutionStatus::Success;
     }
 
+    ExecutionStatus ri_jmp_unchecked(const Ins &ins, size_t &pointer, [[maybe_unused]] const StdArgs &args) {
+        pointer = ins.label_pointer;
+        return ExecutionStatus::Success;
+    }
+
     ExecutionStatus ri_jr(const Ins &ins, size_t &pointer, const StdArgs &args) {
         if (args[0].getType() != utils::ArgType::identifier && args[0].getType() != utils::ArgType::keyword) {
             throw std::runtime_error("Invalid argument type: " + args[0].toString());
@@ -2190,7 +3193,7 @@ namespace exes {
             throw std::runtime_error("Invalid argument type: " + args[2].toString());
         }
         if (compGroup->compare(relational)) {
-            const int &label = InsSet::exe_stack.top()->getLabel(args[2].getValue());
+            const int &label = ExecutionState::current().exe_stack.top()->getLabel(args[2].getValue());
             if (label == -1) {
                 throw std::runtime_error("Invalid label: " + args[2].getValue());
                 return ExecutionStatus::FailedWithError;
@@ -2200,10 +3203,51 @@ namespace exes {
         return ExecutionStatus::Success;
     }
 
+    ExecutionStatus ri_jr_unchecked(const Ins &ins, size_t &pointer, const StdArgs &args) {
+        const auto compData = tools::getArgOriginData(args[0]);
+        if (compData->getTypeID() != data::CompareGroup::typeId) {
+            throw std::runtime_error("Invalid argument type: " + args[0].toString());
+        }
+        if (static_pointer_cast<data::CompareGroup>(compData)->compare(base::stringToRelational(args[1].getValue()))) {
+            pointer = ins.label_pointer;
+        }
+        return ExecutionStatus::Success;
+    }
+
+    // жתǷΪ٣ֵΪ 0ַ Null
+    bool isFalseConditionData(const std::shared_ptr<base::RVM_Data> &est) {
+        const auto &est_type_id = est->getTypeID();
+        if (est_type_id.fullEqualWith(data::Int::typeId) || est_type_id.fullEqualWith(data::Bool::typeId) ||
+            est_type_id.fullEqualWith(data::Char::typeId)) {
+            return static_pointer_cast<data::Int>(est)->getValue() == 0;
+        }
+        if (est_type_id.fullEqualWith(data::Float::typeId)) {
+            return std::abs(static_pointer_cast<data::Float>(est)->getValue()) < 0.0000001;
+        }
+        if (est_type_id.fullEqualWith(data::String::typeId)) {
+            return static_pointer_cast<data::String>(est)->getValStr().empty();
+        }
+        return est_type_id.fullEqualWith(data::Null::typeId);
+    }
+
+    ExecutionStatus ri_jf_unchecked(const Ins &ins, size_t &pointer, const StdArgs &args) {
+        if (isFalseConditionData(tools::getArgOriginData(args[0]))) {
+            pointer = ins.label_pointer;
+        }
+        return ExecutionStatus::Success;
+    }
+
+    ExecutionStatus ri_jt_unchecked(const Ins &ins, size_t &pointer, const StdArgs &args) {
+        if (!isFalseConditionData(tools::getArgOriginData(args[0]))) {
+            pointer = ins.label_pointer;
+        }
+        return ExecutionStatus::Success;
+    }
+
     ExecutionStatus ri_jf(const Ins &ins, size_t &pointer, const StdArgs &args) {
         const auto &est = tools::getArgOriginData(args[0]);
         const auto &est_type_id = est->getTypeID();
-        const auto &label = InsSet::exe_stack.top()->getLabel(args[1].getValue());
+        const auto &label = ExecutionState::current().exe_stack.top()->getLabel(args[1].getValue());
         if (label == -1) {
             throw std::runtime_error("Invalid label: " + args[1].getValue());
             return ExecutionStatus::FailedWithError;
@@ -2235,7 +3279,7 @@ namespace exes {
     ExecutionStatus ri_jt(const Ins &ins, size_t &pointer, const StdArgs &args) {
         const auto &est = tools::getArgOriginData(args[0]);
         const auto &est_type_id = est->getTypeID();
-        const auto &label = InsSet::exe_stack.top()->getLabel(args[1].getValue());
+        const auto &label = ExecutionState::current().exe_stack.top()->getLabel(args[1].getValue());
 
         if (label == -1) {
             throw std::runtime_error("Invalid label: " + args[1].getValue());
@@ -2268,19 +3312,25 @@ namespace exes {
     }
 
     ExecutionStatus ri_cmp(const Ins &ins, size_t &pointer, const StdArgs &args) {
+        tools::checkArgumentType(ins, args[2], 3,
+                                 {utils::ArgType::keyword, utils::ArgType::identifier});
+        return ri_cmp_unchecked(ins, pointer, args);
+    }
+
+    ExecutionStatus ri_cmp_unchecked(const Ins &ins, [[maybe_unused]] size_t &pointer, const StdArgs &args) {
         auto error_arg = args[0];
         try
         {
-            static auto data_check = [&args](
+            const auto data_check = [&args](
                     const utils::Arg &arg) -> std::pair<id::DataID, std::shared_ptr<base::RVM_Data>> {
                 switch (arg.getType()) {
                 case utils::ArgType::identifier:
                 case utils::ArgType::keyword: {
-                        auto [id, data] = data_space_pool.findDataByNameNoLock(arg.getValue());
+                        auto [id, data] = data_space_pool().findDataByNameNoLock(arg.getSymbol());
                         return {id, data};
                 }
                 default: {
-                        auto [id, data] = data_space_pool.addData(
+                        auto [id, data] = data_space_pool().addData(
                                 args[2].getValue() + "_id_" + std::to_string(
                                         tools::getArgOriginData(arg)->getInstID().dis_id),
                                 tools::getArgOriginData(arg));
@@ -2298,16 +3348,14 @@ namespace exes {
                 throw base::errors::MemoryError(unknown_, unknown_, {}, {});
             }
             error_arg = args[2];
-            tools::checkArgumentType(ins, args[2], 3,
-                                         {utils::ArgType::keyword, utils::ArgType::identifier});
             const auto& dataName = args[2].getValue();
-            data_space_pool.updateDataByNameNoLock(dataName,
+            data_space_pool().updateDataByNameNoLock(dataName,
                                                    std::make_shared<data::CompareGroup>(
                                                        std::make_shared<id::DataID>(leftID),
                                                        std::make_shared<id::DataID>(rightID)));
         }
         catch (const base::errors::MemoryError &_) {
-            throw base::errors::MemoryError(error_arg.getPosStr(), ins.raw_code,
+            throw base::errors::MemoryError(error_arg.getPosStr(), ins.rawCode(),
                                             {"This error is caused by accessing memory space that does not exist.",
                                              "Nonexistent Space Name: " + error_arg.toString()},
                                             {"Use the " + ris::ALLOT.toString() +
@@ -2321,7 +3369,7 @@ namespace exes {
         try {
             const auto &cmp = tools::getArgOriginData(args[0]);
             if (!cmp->getTypeID().fullEqualWith(data::CompareGroup::typeId)) {
-                throw base::errors::ArgTypeMismatchError(args[0].getPosStr(), ins.raw_code,
+                throw base::errors::ArgTypeMismatchError(args[0].getPosStr(), ins.rawCode(),
                                                       {"Error Type: " + cmp->getTypeID().toString(),
                                                        "Expected Type: " + data::CompareGroup::typeId.toString()},
                                                       {"The first argument of " + ins.ri->toString() + " must be " +
@@ -2331,15 +3379,57 @@ namespace exes {
             error_arg = args[1];
             const auto &relational = base::stringToRelational(args[1].getValue());
             error_arg = args[2];
-            data_space_pool.updateDataByNameNoLock(args[2].getValue(),
+            data_space_pool().updateDataByNameNoLock(args[2].getSymbol(),
                                                    std::make_shared<data::Bool>(cmp_data->compare(relational)));
         } catch (const base::errors::MemoryError &_){
-            throw base::errors::MemoryError(error_arg.getPosStr(), ins.raw_code,
+            throw base::errors::MemoryError(error_arg.getPosStr(), ins.rawCode(),
+                                            {"This error is caused by accessing memory space that does not exist.",
+                                             "Nonexistent Space Name: " + error_arg.toString()},
+                                            {"Use the " + ris::ALLOT.toString() +
+                                             " to manually allocate a named memory space before accessing it."});
+        }
+        return ExecutionStatus::Success;
+    }
+
+    // Ƚ CMPJ ָʹԤȹݣʶֱӴڴȡ
+    bool compareFusedOperands(const Ins &ins, const StdArgs &args) {
+        auto &fused_compare = ins.cached<FusedCompare>();
+        if (!fused_compare) {
+            fused_compare = FusedCompare::build(ins);
+        }
+        const auto &fused = *fused_compare;
+        auto error_arg = args[0];
+        try {
+            const auto left = fused.constants[0] ? fused.constants[0] : tools::getArgOriginData(args[0]);
+            error_arg = args[1];
+            const auto right = fused.constants[1] ? fused.constants[1] : tools::getArgOriginData(args[1]);
+            return left->compare(right, fused.relation);
+        } catch (const base::errors::MemoryError &_) {
+            throw base::errors::MemoryError(error_arg.getPosStr(), ins.rawCode(),
                                             {"This error is caused by accessing memory space that does not exist.",
                                              "Nonexistent Space Name: " + error_arg.toString()},
                                             {"Use the " + ris::ALLOT.toString() +
                                              " to manually allocate a named memory space before accessing it."});
         }
+    }
+
+    ExecutionStatus ri_cmpj(const Ins &ins, size_t &pointer, const StdArgs &args) {
+        tools::checkArgumentType(ins, args[2], 3, {utils::ArgType::keyword});
+        tools::checkArgumentType(ins, args[3], 4, {utils::ArgType::identifier});
+        if (compareFusedOperands(ins, args)) {
+            const int &label = ExecutionState::current().exe_stack.top()->getLabel(args[3].getValue());
+            if (label == -1) {
+                throw std::runtime_error("Invalid label: " + args[3].getValue());
+            }
+            pointer = label;
+        }
+        return ExecutionStatus::Success;
+    }
+
+    ExecutionStatus ri_cmpj_unchecked(const Ins &ins, size_t &pointer, const StdArgs &args) {
+        if (compareFusedOperands(ins, args)) {
+            pointer = ins.label_pointer;
+        }
         return ExecutionStatus::Success;
     }
 
@@ -2348,9 +3438,15 @@ namespace exes {
             throw std::runtime_error("Third argument must be an identifier");
             return ExecutionStatus::FailedWithError;
         }
-        auto [data1, data2] = [&args]() -> std::pair<std::shared_ptr<data::Numeric>, std::shared_ptr<data::Numeric>> {
+        return ri_mul_unchecked(ins, pointer, args);
+    }
+
+    ExecutionStatus ri_mul_unchecked(const Ins &ins, [[maybe_unused]] size_t &pointer, const StdArgs &args) {
+        auto [data1, data2] = [&args, &ins]() -> std::pair<std::shared_ptr<data::Numeric>, std::shared_ptr<data::Numeric>> {
             auto d1 = tools::getArgNewData(args[0]);
             auto d2 = tools::getArgNewData(args[1]);
+            ins.feedback().recordOperand(0, d1->getTypeID().idType);
+            ins.feedback().recordOperand(1, d2->getTypeID().idType);
             // ǰͼ飬dynamic_cast
             if (d1->getTypeID() != data::Numeric::typeId ||
                 d2->getTypeID() != data::Numeric::typeId) {
@@ -2361,24 +3457,72 @@ namespace exes {
                     static_pointer_cast<data::Numeric>(d2)
             };
         }();
-        data_space_pool.updateDataByNameNoLock(args[2].getValue(), data1->multiply(data2));
+        if (!executeArithmeticInPlace(args[2].getSymbol(), data1, data2, std::multiplies())) {
+            data_space_pool().updateDataByNameNoLock(args[2].getSymbol(), data1->multiply(data2));
+        }
         return ExecutionStatus::Success;
     }
 
+    // ʧܣͷִָкɱִ
+    ExecutionStatus deoptimize(const Ins &ins, size_t &pointer, const StdArgs &args) {
+        ins.feedback().reset();
+        ++ins.feedback().deopt_count;
+        ins.executor = ins.ri->uncheckedExecutor;
+        return ins.executor(ins, pointer, args);
+    }
+
+    template <typename T, typename Op>
+    ExecutionStatus executeQuickenedArithmetic(const Ins &ins, size_t &pointer, const StdArgs &args, Op op) {
+        const auto &left = tools::getArgOriginDataNoError(args[0]);
+        const auto &right = tools::getArgOriginDataNoError(args[1]);
+        if (!left || !right ||
+            left->getTypeID().idType != T::typeId.idType || right->getTypeID().idType != T::typeId.idType) {
+            return deoptimize(ins, pointer, args);
+        }
+        const auto &value = op(std::static_pointer_cast<T>(left)->getValue(),
+                               std::static_pointer_cast<T>(right)->getValue());
+        if (storeArithmeticResultInPlace<T>(args[2].getSymbol(), value)) {
+            return ExecutionStatus::Success;
+        }
+        try {
+            data_space_pool().updateDataByNameNoLock(args[2].getSymbol(), std::make_shared<T>(value));
+        } catch (const base::errors::MemoryError &_) {
+            // ִͨк
+            return deoptimize(ins, pointer, args);
+        }
+        return ExecutionStatus::Success;
+    }
+
+    ExecutionStatus ri_add_int_int(const Ins &ins, size_t &pointer, const StdArgs &args) {
+        return executeQuickenedArithmetic<data::Int>(ins, pointer, args, std::plus());
+    }
+
+    ExecutionStatus ri_add_float_float(const Ins &ins, size_t &pointer, const StdArgs &args) {
+        return executeQuickenedArithmetic<data::Float>(ins, pointer, args, std::plus());
+    }
+
+    ExecutionStatus ri_mul_int_int(const Ins &ins, size_t &pointer, const StdArgs &args) {
+        return executeQuickenedArithmetic<data::Int>(ins, pointer, args, std::multiplies());
+    }
+
+    ExecutionStatus ri_mul_float_float(const Ins &ins, size_t &pointer, const StdArgs &args) {
+        return executeQuickenedArithmetic<data::Float>(ins, pointer, args, std::multiplies());
+    }
+
     ExecutionStatus ri_iter_apnd(const Ins &ins, size_t &pointer, const StdArgs &args) {
         auto error_arg = args[0];
         try {
             const auto &arg_size = args.size();
             if (arg_size < 2) {
-                throw base::errors::ArgumentNumberError(ins.pos.toString(), ins.raw_code,
+                throw base::errors::ArgumentNumberError(ins.pos.toString(), ins.rawCode(),
                                                         "2+", arg_size,
-                                                        ins.ri->name, {});
+                                                        std::string(ins.ri->name), {});
             }
             const auto &target_arg = args[arg_size - 1];
             error_arg = target_arg;
             if (target_arg.getType() != utils::ArgType::identifier &&
                 target_arg.getType() != utils::ArgType::keyword) {
-                throw base::errors::ArgTypeMismatchError(target_arg.getPos().toString(), ins.raw_code,
+                throw base::errors::ArgTypeMismatchError(target_arg.getPos().toString(), ins.rawCode(),
                                                       {"The last arg of the " + ins.ri->toString() + " must be " +
                                                        getTypeFormatString(utils::ArgType::identifier)
                                                        + " or " + getTypeFormatString(utils::ArgType::keyword) +
@@ -2391,7 +3535,7 @@ namespace exes {
             const auto &target_data = tools::getArgOriginData(target_arg);
             if (target_data->getTypeID() != data::Iterable::typeId &&
                 target_data->getTypeID() != data::String::typeId) {
-                throw base::errors::DataTypeMismatchError(target_arg.getPos().toString(), ins.raw_code,
+                throw base::errors::DataTypeMismatchError(target_arg.getPos().toString(), ins.rawCode(),
                                                       {"The target data of the "
                                                           + ris::ITER_APND.toString() + " must be "
                                                           + data::Iterable::typeId.toString() + ".",
@@ -2411,14 +3555,14 @@ namespace exes {
                 target->append(data);
             }
         } catch (const base::errors::MemoryError &_){
-            throw base::errors::MemoryError(error_arg.getPosStr(), ins.raw_code,
+            throw base::errors::MemoryError(error_arg.getPosStr(), ins.rawCode(),
                                             {"This error is caused by accessing memory space that does not exist.",
                                              "Nonexistent Space Name: " + error_arg.toString()},
                                             {"Use the " + ris::ALLOT.toString() +
                                              " to manually allocate a named memory space before accessing it."});
         } catch (base::errors::ArgTypeMismatchError &e) {
             e.error_position = error_arg.getPosStr();
-            e.error_line = ins.raw_code;
+            e.error_line = ins.rawCode();
             e.error_info.insert(e.error_info.begin() + 1,
                 "Error arg: " + utils::getSpaceFormatString(error_arg.getValue(),
                     tools::getArgOriginDataNoError(error_arg)->toString()));
@@ -2431,7 +3575,7 @@ namespace exes {
         auto error_arg = args[3];
         try {
             if (args[3].getType() != utils::ArgType::identifier && args[3].getType() != utils::ArgType::keyword) {
-                throw base::errors::ArgTypeMismatchError(args[3].getPos().toString(), ins.raw_code,
+                throw base::errors::ArgTypeMismatchError(args[3].getPos().toString(), ins.rawCode(),
                                                       {"The type of the target argument of the " +
                                                        ins.ri->toString() +
                                                        " cannot be an immutable argument type.",
@@ -2442,7 +3586,7 @@ namespace exes {
             error_arg = args[0];
             const auto &target = tools::getArgOriginData(args[0]);
             if (!tools::isIterableData(target->getTypeID())) {
-                throw base::errors::ArgTypeMismatchError(args[0].getPos().toString(), ins.raw_code,
+                throw base::errors::ArgTypeMismatchError(args[0].getPos().toString(), ins.rawCode(),
                                                       {"The target data of the " + ins.ri->toString() +
                                                        " must be " + data::Iterable::typeId.toString() + ".",
                                                        "Error Data: " +
@@ -2457,7 +3601,7 @@ namespace exes {
                 auto validateArgType = [&](const auto &arg, size_t argIndex) {
                     const auto &index = tools::getArgOriginData(arg);
                     if (index->getTypeID() != data::Int::typeId) {
-                        throw base::errors::DataTypeMismatchError(arg.getPosStr(), ins.raw_code,
+                        throw base::errors::DataTypeMismatchError(arg.getPosStr(), ins.rawCode(),
                                                               {"The type of the " + std::to_string(argIndex) +
                                                                "-th argument of the " +
                                                                ins.ri->toString() + " must be " +
@@ -2481,15 +3625,15 @@ namespace exes {
             }();
             error_arg = args[3];
             if (begin < 0 || begin > end || begin >= target_data->size() || end < 0) {
-                throw base::RVM_Error(base::ErrorType::RangeError, args[2].getPosStr(), ins.raw_code,
+                throw base::RVM_Error(base::ErrorType::RangeError, args[2].getPosStr(), ins.rawCode(),
                                       {"This error is caused by index values that are out of the iterable range.",
                                        "Error Range: [" + std::to_string(begin) + ", " + std::to_string(end) + ")",
                                        "Available Range: [0, " + std::to_string(target_data->size()) + ")"},
                                       {"Modify the range of indexes to be obtained."});
             }
-            data_space_pool.updateDataByNameNoLock(args[3].getValue(), target_data->subpart(begin, end));
+            data_space_pool().updateDataByNameNoLock(args[3].getSymbol(), target_data->subpart(begin, end));
         } catch (const base::errors::MemoryError &_) {
-            throw base::errors::MemoryError(error_arg.getPosStr(), ins.raw_code,
+            throw base::errors::MemoryError(error_arg.getPosStr(), ins.rawCode(),
                                             {"This error is caused by accessing memory space that does not exist.",
                                              "Nonexistent Space Name: " + error_arg.toString()},
                                             {"Use the " + ris::ALLOT.toString() +
@@ -2500,7 +3644,7 @@ namespace exes {
 
     ExecutionStatus ri_iter_size(const Ins &ins, size_t &pointer, const StdArgs &args) {
         if (args[1].getType() != utils::ArgType::identifier && args[1].getType() != utils::ArgType::keyword) {
-            throw base::errors::ArgTypeMismatchError(args[1].getPos().toString(), ins.raw_code,
+            throw base::errors::ArgTypeMismatchError(args[1].getPos().toString(), ins.rawCode(),
                                                   {"The type of the target argument of the " +
                                                    ins.ri->toString() +
                                                    " cannot be an immutable argument type.",
@@ -2508,11 +3652,15 @@ namespace exes {
                                                   {"Check whether the target data of the " + ins.ri->toString() +
                                                    " instruction is of mutable type."});
         }
+        return ri_iter_size_unchecked(ins, pointer, args);
+    }
+
+    ExecutionStatus ri_iter_size_unchecked(const Ins &ins, [[maybe_unused]] size_t &pointer, const StdArgs &args) {
         auto error_arg = args[0];
         try {
             const auto &data = tools::getArgOriginData(args[0]);
             if (!tools::isIterableData(data->getTypeID())) {
-                throw base::errors::ArgTypeMismatchError(args[0].getPosStr(), ins.raw_code,
+                throw base::errors::ArgTypeMismatchError(args[0].getPosStr(), ins.rawCode(),
                                                       {"The type of the target argument of the " +
                                                        ins.ri->toString() +
                                                        " must be " + data::Iterable::typeId.toString() + ".",
@@ -2523,12 +3671,12 @@ namespace exes {
                                                        " instruction is of iterable type."});
             }
             error_arg = args[1];
-            data_space_pool.updateDataByNameNoLock(args[1].getValue(),
+            data_space_pool().updateDataByNameNoLock(args[1].getSymbol(),
                                                    std::make_shared<data::Int>(
                                                            std::static_pointer_cast<data::Iterable>(data)->
                                                                    size()));
         } catch ([[maybe_unused]] const base::errors::MemoryError &e) {
-            throw base::errors::MemoryError(error_arg.getPosStr(), ins.raw_code,
+            throw base::errors::MemoryError(error_arg.getPosStr(), ins.rawCode(),
                                             {"This error is caused by accessing memory space that does not exist.",
                                              "Nonexistent Space Name: " + error_arg.toString()},
                                             {"Use the " + ris::ALLOT.toString() +
@@ -2540,23 +3688,29 @@ namespace exes {
     ExecutionStatus ri_iter_get(const Ins &ins, size_t &pointer, const StdArgs &args)
     {
         // ǰ args[2] 
-        const auto &targetArg = args[2];
-        if (targetArg.getType() != utils::ArgType::identifier && targetArg.getType() != utils::ArgType::keyword) {
+        if (const auto &targetArg = args[2];
+            targetArg.getType() != utils::ArgType::identifier && targetArg.getType() != utils::ArgType::keyword) {
             throw base::errors::ArgTypeMismatchError(
-                    targetArg.getPos().toString(), ins.raw_code,
+                    targetArg.getPos().toString(), ins.rawCode(),
                     {"The type of the target argument of the " + ins.ri->toString() +
                      " cannot be an immutable argument type.",
                      "Error Arg: " + targetArg.toString()},
                     {"Check whether the target data of the " + ins.ri->toString() +
                      " instruction is of mutable type."});
         }
+        return ri_iter_get_unchecked(ins, pointer, args);
+    }
+
+    ExecutionStatus ri_iter_get_unchecked(const Ins &ins, [[maybe_unused]] size_t &pointer, const StdArgs &args)
+    {
+        const auto &targetArg = args[2];
 
         // ȡ
         const auto &iterArg = args[0];
         const auto iterData = tools::getArgOriginData(iterArg);
         if (!tools::isIterableData(iterData->getTypeID())) {
             throw base::errors::ArgTypeMismatchError(
-                    iterArg.getPosStr(), ins.raw_code,
+                    iterArg.getPosStr(), ins.rawCode(),
                     {"The type of the target argument of the " + ins.ri->toString() +
                      " must be " + data::Iterable::typeId.toString() + ".",
                      "Error Data: " + utils::getSpaceFormatString(iterArg.getValue(), iterData->toString())},
@@ -2581,7 +3735,7 @@ namespace exes {
             {
                 if (!indexData->getTypeID().fullEqualWith(data::Int::typeId)) {
                     throw base::errors::ArgTypeMismatchError(
-                            indexArg.getPosStr(), ins.raw_code,
+                            indexArg.getPosStr(), ins.rawCode(),
                             {"The type of the index argument of the " + ins.ri->toString() +
                              " must be " + data::Int::typeId.toString() + ".",
                              "Error Data: " + utils::getSpaceFormatString(indexArg.getValue(), indexData->toString())},
@@ -2592,7 +3746,7 @@ namespace exes {
                 const auto &index = std::static_pointer_cast<data::Int>(indexData);
                 if (index->getValue() >= iter->size() || index->getValue() < 0) {
                     throw base::RVM_Error(
-                            base::ErrorType::RangeError, indexArg.getPosStr(), ins.raw_code,
+                            base::ErrorType::RangeError, indexArg.getPosStr(), ins.rawCode(),
                             {"The index of the " + ins.ri->toString() + " instruction is out of range.",
                              "Index: " + std::to_string(index->getValue()),
                              "Size: " + std::to_string(iter->size())},
@@ -2602,9 +3756,9 @@ namespace exes {
             }
 
             // ȡݲڴ
-            data_space_pool.updateDataByNameNoLock(targetArg.getValue(), data);
+            data_space_pool().updateDataByNameNoLock(targetArg.getSymbol(), data);
         } catch (const base::errors::MemoryError &_) {
-            throw base::errors::MemoryError(targetArg.getPosStr(), ins.raw_code,
+            throw base::errors::MemoryError(targetArg.getPosStr(), ins.rawCode(),
                                             {"This error is caused by accessing memory space that does not exist.",
                                              "Nonexistent Space Name: " + targetArg.toString()},
                                             {"Use the " + ris::ALLOT.toString() +
@@ -2627,7 +3781,7 @@ namespace exes {
             // 
             if (!tools::isIterableData(iter_container->getTypeID())) {
                 throw base::errors::ArgTypeMismatchError(
-                        args[0].getPosStr(), ins.raw_code,
+                        args[0].getPosStr(), ins.rawCode(),
                         {"The type of the target argument of the " + ins.ri->toString() +
                          " must be " + data::Iterable::typeId.toString() + ".",
                          "Error Data: " + utils::getSpaceFormatString(args[0].getValue(),
@@ -2639,24 +3793,24 @@ namespace exes {
             const auto &iter_container_data = std::static_pointer_cast<data::Iterable>(iter_container);
 
             //  reverse ʹǷ
-            data_space_pool.acquireScope(reverse ? pre_ITER_REV_TRAV : pre_ITER_TRAV);
+            data_space_pool().acquireScope(reverse ? pre_ITER_REV_TRAV : pre_ITER_TRAV);
 
             const int &container_size = static_cast<int>(iter_container_data->size());
             const int start = reverse ? container_size - 1 : 0;
             const int end = reverse ? -1 : container_size;
             const int step = reverse ? -1 : 1;
             for (int i = start; i != end; i += step) {
-                data_space_pool.updateDataByNameNoLock(iter_elem.getValue(),
+                data_space_pool().updateDataByNameNoLock(iter_elem.getSymbol(),
                                                        iter_container_data->getDataAt(i)->copy_ptr());
-                data_space_pool.updateDataByNameNoLock(iter_index.getValue(),
+                data_space_pool().updateDataByNameNoLock(iter_index.getSymbol(),
                                                        std::make_shared<data::Int>(reverse ? start - i : i));
-                if (ins.scopeInsSet->execute() == ExecutionStatus::Aborted) {
+                if (ins.scopeInsSet()->execute() == ExecutionStatus::Aborted) {
                     break;
                 }
             }
-            data_space_pool.releaseScopeNoLock(data_space_pool.getCurrentScopeNoLock());
+            data_space_pool().releaseScopeNoLock(data_space_pool().getCurrentScopeNoLock());
         } catch (const base::errors::MemoryError &_) {
-            throw base::errors::MemoryError(error_arg.getPosStr(), ins.raw_code,
+            throw base::errors::MemoryError(error_arg.getPosStr(), ins.rawCode(),
                                             {"This error is caused by accessing memory space that does not exist.",
                                              "Nonexistent Space Name: " + error_arg.toString()},
                                             {"Use the " + ris::ALLOT.toString() +
@@ -2677,7 +3831,7 @@ namespace exes {
         const auto &iter_container = tools::getArgOriginData(args[0]);
         if (!tools::isIterableData(iter_container->getTypeID())) {
             throw base::errors::ArgTypeMismatchError(
-                    args[0].getPosStr(), ins.raw_code,
+                    args[0].getPosStr(), ins.rawCode(),
                     {"The type of the target argument of the " + ins.ri->toString() +
                      " must be " + data::Iterable::typeId.toString() + ".",
                      "Error Data: " + utils::getSpaceFormatString(args[0].getValue(),
@@ -2690,7 +3844,7 @@ namespace exes {
         const auto &data = tools::getArgOriginData(args[2]);
         if (index->getTypeID() != data::Int::typeId) {
             throw base::errors::ArgTypeMismatchError(
-                    args[1].getPosStr(), ins.raw_code,
+                    args[1].getPosStr(), ins.rawCode(),
                     {"The type of the index argument of the " + ins.ri->toString() +
                      " must be " + data::Int::typeId.toString() + ".",
                      "Error Data: " + utils::getSpaceFormatString(args[1].getValue(),
@@ -2705,14 +3859,14 @@ namespace exes {
 
     ExecutionStatus ri_iter_del(const Ins &ins, size_t &pointer, const StdArgs &args) {
         if (args.size() < 2) {
-            throw base::errors::ArgumentNumberError(ins.pos.toString(), ins.raw_code,
+            throw base::errors::ArgumentNumberError(ins.pos.toString(), ins.rawCode(),
                                                     "2+", args.size(), ins.ri->toString(),
                                                     {"Add more index arg to fix this error."});
         }
         const auto &iter_container = tools::getArgOriginData(args[0]);
         if (!tools::isIterableData(iter_container->getTypeID())) {
             throw base::errors::ArgTypeMismatchError(
-                    args[0].getPosStr(), ins.raw_code,
+                    args[0].getPosStr(), ins.rawCode(),
                     {"The type of the target argument of the " + ins.ri->toString() +
                      " must be " + data::Iterable::typeId.toString() + ".",
                      "Error Data: " + utils::getSpaceFormatString(args[0].getValue(),
@@ -2725,7 +3879,7 @@ namespace exes {
             const auto &index = tools::getArgOriginData(args[i]);
             if (index->getTypeID() != data::Int::typeId) {
                 throw base::errors::ArgTypeMismatchError(
-                        args[i].getPosStr(), ins.raw_code,
+                        args[i].getPosStr(), ins.rawCode(),
                         {"The type of the index argument of the " + ins.ri->toString() +
                          " must be " + data::Int::typeId.toString() + "."},
                         {"Check whether the target data of the " + ins.ri->toString() +
@@ -2740,7 +3894,7 @@ namespace exes {
         const auto &iter_container = tools::getArgOriginData(args[0]);
         if (!tools::isIterableData(iter_container->getTypeID())) {
             throw base::errors::ArgTypeMismatchError(
-                    args[0].getPosStr(), ins.raw_code,
+                    args[0].getPosStr(), ins.rawCode(),
                     {"The type of the target argument of the " + ins.ri->toString() +
                      " must be " + data::Iterable::typeId.toString() + ".",
                      "Error Data: " + utils::getSpaceFormatString(args[0].getValue(),
@@ -2752,7 +3906,7 @@ namespace exes {
         const auto &index = tools::getArgOriginData(args[1]);
         if (index->getTypeID() != data::Int::typeId) {
             throw base::errors::ArgTypeMismatchError(
-                    args[1].getPosStr(), ins.raw_code,
+                    args[1].getPosStr(), ins.rawCode(),
                     {"The type of the index argument of the " + ins.ri->toString() +
                      " must be " + data::Int::typeId.toString() + "."},
                     {"Check whether the target data of the " + ins.ri->toString() +
@@ -2770,7 +3924,7 @@ namespace exes {
             const auto &iter_container = tools::getArgOriginData(args[0]);
             if (!tools::isIterableData(iter_container->getTypeID())) {
                 throw base::errors::ArgTypeMismatchError(
-                        args[0].getPosStr(), ins.raw_code,
+                        args[0].getPosStr(), ins.rawCode(),
                         {"The type of the target argument of the " + ins.ri->toString() +
                          " must be " + data::Iterable::typeId.toString() + ".",
                          args[0].getType() == utils::ArgType::identifier ?
@@ -2783,7 +3937,7 @@ namespace exes {
             const auto &iter_container_data = std::static_pointer_cast<data::Iterable>(iter_container);
             if (args.size() - 1 != iter_container_data->size()) {
                 throw base::RVM_Error(base::ErrorType::ArgumentError, args[args.size() - 1].getPosStr(),
-                                      ins.raw_code,
+                                      ins.rawCode(),
                                       {"This error is caused by a mismatch in the number of arguments passed in when unpacking the iterable data.",
                                        "Iterable Data: " + iter_container_data->toString(),
                                        "Required Arg Number: " + std::to_string(iter_container_data->size()),
@@ -2795,11 +3949,11 @@ namespace exes {
             {
                 const auto& data = iter_container_data->getDataAt(i);
                 error_arg = args[i + 1];
-                data_space_pool.updateDataByNameNoLock(args[i + 1].getValue(), data);
+                data_space_pool().updateDataByNameNoLock(args[i + 1].getSymbol(), data);
             }
         }
         catch (base::errors::MemoryError &_){
-            throw base::errors::MemoryError(error_arg.getPos().toString(), ins.raw_code,
+            throw base::errors::MemoryError(error_arg.getPos().toString(), ins.rawCode(),
                                             {"This error is caused by accessing memory space that does not exist.",
                                              "Nonexistent Space Name: " + error_arg.toString()},
                                             {"Use the " + ris::ALLOT.toString() +
@@ -2807,7 +3961,7 @@ namespace exes {
         }
         catch (base::errors::KeyNotFoundError &e)
         {
-            e.error_line = ins.raw_code;
+            e.error_line = ins.rawCode();
             e.error_position = error_arg.getPosStr();
             e.error_info.push_back("Dict data space: " + utils::getSpaceFormatString(
                 args[0].getValue(), tools::getArgOriginData(args[0])->toString()));
@@ -2822,7 +3976,7 @@ namespace exes {
         const auto &min_data = tools::check_arg_data_type<data::Int>(ins, args[0], min);
         const auto &max = tools::getArgOriginData(args[1]);
         const auto &max_data = tools::check_arg_data_type<data::Int>(ins, args[1], max);
-        data_space_pool.updateDataByNameNoLock(args[2].getValue(),
+        data_space_pool().updateDataByNameNoLock(args[2].getSymbol(),
                                                std::make_shared<data::Int>(utils::getRandomInt(min_data->getValue(), max_data->getValue())));
         return ExecutionStatus::Success;
     }
@@ -2860,7 +4014,7 @@ namespace exes {
 
         const auto &decimal_places = tools::getArgOriginData(args[2]);
         const auto &decimal_places_data = tools::check_arg_data_type<data::Int>(ins, args[2], decimal_places);
-        data_space_pool.updateDataByNameNoLock(
+        data_space_pool().updateDataByNameNoLock(
                 args[3].getValue(),
                 std::make_shared<data::Float>(
                         utils::getRandomFloat(min_data,
@@ -2874,7 +4028,7 @@ namespace exes {
         const auto &op_arg = args[0];
         const auto &target_arg = args[1];
         if (target_arg.getType() != utils::ArgType::identifier && target_arg.getType() != utils::ArgType::keyword) {
-            throw base::errors::ArgTypeMismatchError(target_arg.getPos().toString(), ins.raw_code,
+            throw base::errors::ArgTypeMismatchError(target_arg.getPos().toString(), ins.rawCode(),
                                                   {"The type of the target argument of the " +
                                                    ins.ri->toString() +
                                                    " cannot be an immutable argument type.",
@@ -2903,7 +4057,7 @@ namespace exes {
                 case utils::ArgType::keyword: {
                     if (const auto ri_opt = RI::getRIByStr(op_arg.getValue()); ri_opt) {
                         const auto &ri = ri_opt;
-                        type_info = std::make_shared<data::String>(ri->id.toString());
+                        type_info = std::make_shared<data::String>(ri->getIDString());
                     } else {
                         const auto &op_data = tools::getArgOriginData(op_arg);
                         type_info = std::make_shared<data::String>(op_data->getTypeID().toString());
@@ -2915,9 +4069,9 @@ namespace exes {
                     break;
             }
             error_arg = target_arg;
-            data_space_pool.updateDataByNameNoLock(target_arg.getValue(), type_info);
+            data_space_pool().updateDataByNameNoLock(target_arg.getSymbol(), type_info);
         } catch ([[maybe_unused]] const base::errors::MemoryError &e) {
-            throw base::errors::MemoryError(error_arg.getPos().toString(), ins.raw_code,
+            throw base::errors::MemoryError(error_arg.getPos().toString(), ins.rawCode(),
                                             {"This error is caused by accessing memory space that does not exist.",
                                              "Nonexistent Space Name: " + error_arg.toString()},
                                             {"Use the " + ris::ALLOT.toString() +
@@ -2928,6 +4082,10 @@ namespace exes {
 
     ExecutionStatus ri_div(const Ins &ins, size_t &pointer, const StdArgs &args) {
         tools::checkArgumentType(ins, args[2], 2, {utils::ArgType::identifier, utils::ArgType::keyword});
+        return ri_div_unchecked(ins, pointer, args);
+    }
+
+    ExecutionStatus ri_div_unchecked(const Ins &ins, [[maybe_unused]] size_t &pointer, const StdArgs &args) {
         auto [data1, data2] = [&args]() -> std::pair<std::shared_ptr<data::Numeric>, std::shared_ptr<data::Numeric>> {
             const auto d1 = tools::getArgNewData(args[0]);
             const auto d2 = tools::getArgNewData(args[1]);
@@ -2942,9 +4100,12 @@ namespace exes {
             };
         }();
         try {
-            data_space_pool.updateDataByNameNoLock(args[2].getValue(), data1->divide(data2));
+            if (executeArithmeticInPlace(args[2].getSymbol(), data1, data2, std::divides(), DivisionKeepsType())) {
+                return ExecutionStatus::Success;
+            }
+            data_space_pool().updateDataByNameNoLock(args[2].getSymbol(), data1->divide(data2));
         } catch (const base::errors::MemoryError &_) {
-            throw base::errors::MemoryError(args[2].getPos().toString(), ins.raw_code,
+            throw base::errors::MemoryError(args[2].getPos().toString(), ins.rawCode(),
                                             {"This error is caused by accessing memory space that does not exist.",
                                              "Nonexistent Space Name: " + args[2].toString()},
                                             {"Use the " + ris::ALLOT.toString() +
@@ -2957,7 +4118,7 @@ namespace exes {
         auto validateFirstArg = [&]() {
             if (args[0].getType() != utils::ArgType::keyword && args[0].getType() != utils::ArgType::identifier) {
                 throw base::errors::ArgTypeMismatchError(
-                        args[0].getPos().toString(), ins.raw_code,
+                        args[0].getPos().toString(), ins.rawCode(),
                         {"The type of the first argument must be " +
                          getTypeFormatString(utils::ArgType::keyword) + " or " +
                          getTypeFormatString(utils::ArgType::identifier) + ".",
@@ -2969,7 +4130,7 @@ namespace exes {
         };
 
         auto updateDataSpace = [&](const std::string &name, const std::shared_ptr<base::RVM_Data>& newData) {
-            data_space_pool.updateDataByNameNoLock(name, newData);
+            data_space_pool().updateDataByNameNoLock(name, newData);
         };
 
         validateFirstArg();
@@ -2980,7 +4141,7 @@ namespace exes {
             if (type->getTypeID().fullEqualWith(data::DType::typeId)) {
                 type_uid = static_pointer_cast<data::DType>(type)->getDTypeID().dis_id;
             } else {
-                throw base::errors::ArgumentError(error_arg.getPosStr(), ins.raw_code,
+                throw base::errors::ArgumentError(error_arg.getPosStr(), ins.rawCode(),
                                                   "Error Arg: " + utils::getSpaceFormatString(error_arg.getValue(), type->toString()),
                                                   {"Please check that the argument of this instruction are used correctly.",
                                                    "The " + ins.ri->toString() +
@@ -3136,18 +4297,18 @@ namespace exes {
                 it != typeHandlers.end()) {
                 it->second(data, args, data_val);
             } else {
-                throw base::errors::ArgTypeMismatchError(args[0].getPos().toString(), ins.raw_code, {}, {});
+                throw base::errors::ArgTypeMismatchError(args[0].getPos().toString(), ins.rawCode(), {}, {});
             }
         } catch (const base::errors::MemoryError &) {
             throw base::errors::MemoryError(
-                    error_arg.getPos().toString(), ins.raw_code,
+                    error_arg.getPos().toString(), ins.rawCode(),
                     {"This error is caused by accessing memory space that does not exist.",
                      "Nonexistent Space Name: " + error_arg.toString()},
                     {"Use the " + ris::ALLOT.toString() +
                      " to manually allocate a named memory space before accessing it."});
         } catch (base::errors::ArgTypeMismatchError &e) {
             e.error_position = error_arg.getPosStr();
-            e.error_line = ins.raw_code;
+            e.error_line = ins.rawCode();
             e.error_info.insert(e.error_info.begin() + 1, "Error arg: " + utils::getSpaceFormatString(error_arg.getValue(),
                     tools::getArgOriginDataNoError(error_arg)->toString()));
             throw;
@@ -3158,13 +4319,13 @@ namespace exes {
 
     ExecutionStatus ri_tp_def(const Ins &ins, size_t &pointer, const StdArgs &args) {
         if (args.size() > 2 || args.size() < 1) {
-            throw base::errors::ArgumentNumberError(args[0].getPosStr(), ins.raw_code, "1 / 2", args.size(),
+            throw base::errors::ArgumentNumberError(args[0].getPosStr(), ins.rawCode(), "1 / 2", args.size(),
                                                     ins.ri->toString(), {});
         }
         auto tp_name = args[0].getValue();
         if (const auto arg_data = tools::getArgOriginDataNoError(args[0])) {
             if (arg_data->getTypeID() != data::String::typeId) {
-                throw base::errors::ArgTypeMismatchError(args[0].getPosStr(), ins.raw_code,
+                throw base::errors::ArgTypeMismatchError(args[0].getPosStr(), ins.rawCode(),
                                                       {"Error Arg: " + utils::getSpaceFormatString(
                                                               args[0].getValue(), arg_data->toString()),
                                                        "Target Type: " + data::String::typeId.toString()},
@@ -3174,7 +4335,7 @@ namespace exes {
             tp_name = arg_data->getValStr();
         }
         if (base::containsKeywordInCategory(base::KeywordType::DataTypes, tp_name)) {
-            throw base::errors::DuplicateKeyError(args[0].getPosStr(), ins.raw_code,
+            throw base::errors::DuplicateKeyError(args[0].getPosStr(), ins.rawCode(),
                                                   {"This error is caused by defining a data type with the duplicate name.",
                                                    "Duplicate Name: tp-" + tp_name},
                                                   {"Use a different data type name."});
@@ -3183,7 +4344,7 @@ namespace exes {
         if (args.size() == 2) {
             parent_type = tools::getArgOriginData(args[1]);
             if (parent_type->getTypeID() != data::CustomType::typeId) {
-                throw base::errors::ArgTypeMismatchError(args[1].getPosStr(), ins.raw_code,
+                throw base::errors::ArgTypeMismatchError(args[1].getPosStr(), ins.rawCode(),
                                                       {"Error Arg: " + args[1].toString(),
                                                        "Target Type: " + data::CustomType::typeId.toString()},
                                                       {"The target argument type of the " +
@@ -3195,14 +4356,14 @@ namespace exes {
                                                                 parent_type
                                                                 ? static_pointer_cast<data::CustomType>(parent_type)
                                                                 : nullptr);
-        const auto &_ = data_space_pool.addData(tp_name, new_data_type);
+        const auto &_ = data_space_pool().addData(tp_name, new_data_type);
         return ExecutionStatus::Success;
     }
 
     ExecutionStatus ri_tp_new(const Ins &ins, size_t &pointer, const StdArgs &args) {
         const auto &type_data = tools::getArgOriginData(args[0]);
         if (type_data->getTypeID() != data::CustomType::typeId) {
-            throw base::errors::ArgTypeMismatchError(args[0].getPosStr(), ins.raw_code,
+            throw base::errors::ArgTypeMismatchError(args[0].getPosStr(), ins.rawCode(),
                                                   {"Error Arg: " + args[0].toString(),
                                                    "Target Type: " + data::CustomType::typeId.toString()},
                                                   {"The target argument type of the " +
@@ -3213,10 +4374,10 @@ namespace exes {
         auto type = static_pointer_cast<data::CustomType>(type_data);
         auto new_inst = std::make_shared<data::CustomInst>(type);
         try{
-            data_space_pool.updateDataByNameNoLock(args[1].getValue(), new_inst);
+            data_space_pool().updateDataByNameNoLock(args[1].getSymbol(), new_inst);
         } catch (const base::errors::MemoryError &) {
             throw base::errors::MemoryError(
-                    args[1].getPosStr(), ins.raw_code,
+                    args[1].getPosStr(), ins.rawCode(),
                     {"This error is caused by accessing memory space that does not exist.",
                      "Nonexistent Space Name: " + args[1].toString()},
                     {"Use the " + ris::ALLOT.toString() +
@@ -3227,12 +4388,12 @@ namespace exes {
 
     ExecutionStatus ri_tp_add_tp_field(const Ins &ins, size_t &pointer, const StdArgs &args) {
         if (args.size() > 3 || args.size() < 2) {
-            throw base::errors::ArgumentNumberError(args[0].getPosStr(), ins.raw_code, "2 / 3", args.size(),
+            throw base::errors::ArgumentNumberError(args[0].getPosStr(), ins.rawCode(), "2 / 3", args.size(),
                                                     ins.ri->toString(), {});
         }
         auto arg_data = tools::getArgOriginData(args[0]);
         if (arg_data->getTypeID() != data::CustomType::typeId) {
-            throw base::errors::ArgTypeMismatchError(args[0].getPosStr(), ins.raw_code,
+            throw base::errors::ArgTypeMismatchError(args[0].getPosStr(), ins.rawCode(),
                                                   {"Error Arg: " + args[0].toString(),
                                                    "Target Type: " + data::CustomType::typeId.toString()},
                                                   {"The target argument type of the " +
@@ -3244,7 +4405,7 @@ namespace exes {
         arg_data = tools::getArgOriginDataNoError(args[1]);
         if (arg_data) {
             if (arg_data->getTypeID() != data::String::typeId) {
-                throw base::errors::ArgTypeMismatchError(args[1].getPosStr(), ins.raw_code,
+                throw base::errors::ArgTypeMismatchError(args[1].getPosStr(), ins.rawCode(),
                                                       {"Error Space: " + utils::getSpaceFormatString(field_name,
                                                                                                      arg_data->toString()),
                                                        "Target Type: " + data::String::typeId.toString()},
@@ -3261,7 +4422,7 @@ namespace exes {
         try {
             ct->addTpField(field_name, field_data);
         } catch ([[maybe_unused]] base::errors::DuplicateKeyError &e) {
-            throw base::errors::DuplicateKeyError(args[1].getPosStr(), ins.raw_code,
+            throw base::errors::DuplicateKeyError(args[1].getPosStr(), ins.rawCode(),
                                                   {"This error is caused by defining a data type field with the duplicate name.",
                                                    "Duplicate Name: " + field_name},
                                                   {"Use a different data type field name."});
@@ -3271,14 +4432,14 @@ namespace exes {
 
     ExecutionStatus ri_tp_add_inst_field(const Ins &ins, size_t &pointer, const StdArgs &args) {
         if (args.size() > 3 || args.size() < 2) {
-            throw base::errors::ArgumentNumberError(args[0].getPosStr(), ins.raw_code, "2 / 3", args.size(),
+            throw base::errors::ArgumentNumberError(args[0].getPosStr(), ins.rawCode(), "2 / 3", args.size(),
                                                     ins.ri->toString(), {});
         }
         auto field_name = args[1].getValue();
         auto arg_data = tools::getArgOriginDataNoError(args[1]);
         if (arg_data) {
             if (arg_data->getTypeID() != data::String::typeId) {
-                throw base::errors::ArgTypeMismatchError(args[1].getPosStr(), ins.raw_code,
+                throw base::errors::ArgTypeMismatchError(args[1].getPosStr(), ins.rawCode(),
                                                       {"Error Space: " + utils::getSpaceFormatString(field_name,
                                                                                                      arg_data->toString()),
                                                        "Target Type: " + data::String::typeId.toString()},
@@ -3300,7 +4461,7 @@ namespace exes {
             if (arg_data->getTypeID() == data::CustomType::typeId) {
                 static_pointer_cast<data::CustomType>(arg_data)->addInstField(field_name, field_data);
             } else {
-                throw base::errors::ArgTypeMismatchError(args[0].getPosStr(), ins.raw_code,
+                throw base::errors::ArgTypeMismatchError(args[0].getPosStr(), ins.rawCode(),
                                                       {"Error Arg: " + args[0].toString(),
                                                        "Target Type: " + data::CustomType::typeId.toString()},
                                                       {"The target argument type of the " +
@@ -3308,12 +4469,12 @@ namespace exes {
                                                        data::CustomType::typeId.toString() + "."});
             }
         } catch ([[maybe_unused]] base::errors::DuplicateKeyError &e) {
-            throw base::errors::DuplicateKeyError(args[1].getPosStr(), ins.raw_code,
+            throw base::errors::DuplicateKeyError(args[1].getPosStr(), ins.rawCode(),
                                                   {"This error is caused by defining a data type field with the duplicate name.",
                                                    "Duplicate Name: " + field_name},
                                                   {"Use a different data type field name."});
         } catch ([[maybe_unused]] base::errors::MemoryError &e) {
-            throw base::errors::MemoryError(args[error_index].getPosStr(), ins.raw_code,
+            throw base::errors::MemoryError(args[error_index].getPosStr(), ins.rawCode(),
                                             {"This error is caused by using an non-existent memory space.",
                                              "Error Space: " + utils::getSpaceFormatString(args[error_index].getValue(),
                                                                                            arg_data->toString())},
@@ -3332,7 +4493,7 @@ namespace exes {
         auto arg_data = tools::getArgOriginDataNoError(args[current_arg_index]);
         if (arg_data) {
             if (arg_data->getTypeID() != data::String::typeId) {
-                throw base::errors::ArgTypeMismatchError(args[current_arg_index].getPosStr(), ins.raw_code,
+                throw base::errors::ArgTypeMismatchError(args[current_arg_index].getPosStr(), ins.rawCode(),
                                                       {"Error Space: " + utils::getSpaceFormatString(field_name,
                                                                                                      arg_data->toString()),
                                                        "Target Type: " + data::String::typeId.toString()},
@@ -3360,7 +4521,7 @@ namespace exes {
             } else if (arg_data->getTypeID() == data::CustomInst::typeId) {
                 static_pointer_cast<data::CustomInst>(arg_data)->setField(field_name, field_data);
             } else {
-                throw base::errors::ArgTypeMismatchError(args[current_arg_index].getPosStr(), ins.raw_code,
+                throw base::errors::ArgTypeMismatchError(args[current_arg_index].getPosStr(), ins.rawCode(),
                                                       {"Error Arg: " + args[0].toString(),
                                                        "Target Type: " + data::CustomType::typeId.toString() +
                                                        " / " + data::CustomInst::typeId.toString()},
@@ -3371,14 +4532,14 @@ namespace exes {
             }
         } catch (const base::errors::FieldNotFoundError &_) {
             // ʹõǰȷλ
-            throw base::errors::FieldNotFoundError(args[current_arg_index].getPosStr(), ins.raw_code,
+            throw base::errors::FieldNotFoundError(args[current_arg_index].getPosStr(), ins.rawCode(),
                                                    arg_data->toString(), field_name,
                                                    {"Please ensure that the accessed fields have been defined by the " +
                                                     ris::TP_ADD_INST_FIELD.toString() + " or " +
                                                     ris::TP_ADD_TP_FIELD.toString() + "."});
         } catch ([[maybe_unused]] const base::errors::MemoryError &e) {
             // ʹõǰȷλ
-            throw base::errors::MemoryError(args[current_arg_index].getPosStr(), ins.raw_code,
+            throw base::errors::MemoryError(args[current_arg_index].getPosStr(), ins.rawCode(),
                                             {"This error is caused by using an non-existent memory space.",
                                              "Error Arg: " + args[current_arg_index].toString()},
                                             {"Check the memory space provided for " +
@@ -3386,7 +4547,7 @@ namespace exes {
                                              "."});
         } catch (const std::exception &e) {
             // 쳣ʱҲʹõǰ
-            throw base::RVM_Error(base::ErrorType::RuntimeError, args[current_arg_index].getPosStr(), ins.raw_code,
+            throw base::RVM_Error(base::ErrorType::RuntimeError, args[current_arg_index].getPosStr(), ins.rawCode(),
                                              {"Unexpected error occurred while processing argument",
                                               "Error Arg: " + args[current_arg_index].toString(),
                                               "Error Details: " + std::string(e.what())},
@@ -3402,7 +4563,7 @@ namespace exes {
             auto arg_data = tools::getArgOriginDataNoError(args[1]);
             if (arg_data) {
                 if (arg_data->getTypeID() != data::String::typeId) {
-                    throw base::errors::ArgTypeMismatchError(args[1].getPosStr(), ins.raw_code,
+                    throw base::errors::ArgTypeMismatchError(args[1].getPosStr(), ins.rawCode(),
                                                           {"Error Space: " + utils::getSpaceFormatString(field_name,
                                                                                                          arg_data->toString()),
                                                            "Target Type: " + data::String::typeId.toString()},
@@ -3421,7 +4582,7 @@ namespace exes {
             } else if (arg_data->getTypeID().fullEqualWith(data::CustomInst::typeId)) {
                 field_data = static_pointer_cast<data::CustomInst>(arg_data)->getField(field_name);
             } else {
-                throw base::errors::ArgTypeMismatchError(args[0].getPosStr(), ins.raw_code,
+                throw base::errors::ArgTypeMismatchError(args[0].getPosStr(), ins.rawCode(),
                                                       {"Error Data Space: " +
                                                       utils::getSpaceFormatString(args[0].getValue(),
                                                                                   arg_data->toString()),
@@ -3433,9 +4594,9 @@ namespace exes {
                                                        data::CustomInst::typeId.toString() + "."});
             }
             error_arg = args[2];
-            data_space_pool.updateDataByNameNoLock(args[2].getValue(), field_data);
+            data_space_pool().updateDataByNameNoLock(args[2].getSymbol(), field_data);
         } catch (const base::errors::MemoryError &_){
-            throw base::errors::MemoryError(error_arg.getPosStr(), ins.raw_code,
+            throw base::errors::MemoryError(error_arg.getPosStr(), ins.rawCode(),
                                             {"This error is caused by the getting field was not exist.",
                                              "Nonexistent Field Name: " + utils::getSpaceFormatString(
                                                      error_arg.getValue(),
@@ -3455,7 +4616,7 @@ namespace exes {
             auto parent_type_name = args[1].getValue();
             auto arg_data = tools::getArgOriginData(args[1]);
             if (!arg_data->getTypeID().fullEqualWith(data::CustomType::typeId)) {
-                throw base::errors::ArgTypeMismatchError(args[1].getPosStr(), ins.raw_code,
+                throw base::errors::ArgTypeMismatchError(args[1].getPosStr(), ins.rawCode(),
                                                       {"Error Space: " + utils::getSpaceFormatString(parent_type_name,
                                                                                                      arg_data->toString()),
                                                        "Target Type: " + data::CustomType::typeId.toString()},
@@ -3470,7 +4631,7 @@ namespace exes {
             arg_data = tools::getArgOriginDataNoError(args[2]);
             if (arg_data) {
                 if (arg_data->getTypeID() != data::String::typeId) {
-                    throw base::errors::ArgTypeMismatchError(args[2].getPosStr(), ins.raw_code,
+                    throw base::errors::ArgTypeMismatchError(args[2].getPosStr(), ins.rawCode(),
                                                           {"Error Space: " + utils::getSpaceFormatString(field_name,
                                                                                                          arg_data->toString()),
                                                            "Target Type: " + data::String::typeId.toString()},
@@ -3489,7 +4650,7 @@ namespace exes {
             std::shared_ptr<base::RVM_Data> field_data;
 
             if (arg_data->getTypeID() == data::CustomType::typeId) {
-                throw base::errors::ArgTypeMismatchError(args[0].getPosStr(), ins.raw_code,
+                throw base::errors::ArgTypeMismatchError(args[0].getPosStr(), ins.rawCode(),
                                                       {"Error Data Space: " +
                                                        utils::getSpaceFormatString(args[0].getValue(),
                                                                                    arg_data->toString()),
@@ -3500,7 +4661,7 @@ namespace exes {
                 const auto &inst_data = static_pointer_cast<data::CustomInst>(arg_data);
                 field_data = inst_data->getField(field_name, parent_data);
             } else {
-                throw base::errors::ArgTypeMismatchError(args[0].getPosStr(), ins.raw_code,
+                throw base::errors::ArgTypeMismatchError(args[0].getPosStr(), ins.rawCode(),
                                                       {"Error Data Space: " +
                                                        utils::getSpaceFormatString(args[0].getValue(),
                                                                                    arg_data->toString()),
@@ -3514,9 +4675,9 @@ namespace exes {
 
             // Store target is now args[3] instead of args[2]
             error_arg = args[3];
-            data_space_pool.updateDataByNameNoLock(args[3].getValue(), field_data);
+            data_space_pool().updateDataByNameNoLock(args[3].getSymbol(), field_data);
         } catch ([[maybe_unused]] const base::errors::MemoryError &e) {
-            throw base::errors::MemoryError(error_arg.getPosStr(), ins.raw_code,
+            throw base::errors::MemoryError(error_arg.getPosStr(), ins.rawCode(),
                                             {"This error is caused by the getting field was not exist.",
                                              "Nonexistent Field Name: '" + error_arg.getValue() + "'"},
                                             {"Please use " + ris::TP_ADD_TP_FIELD.toString() + " or " +
@@ -3531,7 +4692,7 @@ namespace exes {
         try {
             const auto &inst = tools::getArgOriginData(args[0]);
             if (!inst->getTypeID().fullEqualWith(data::CustomInst::typeId)) {
-                throw base::errors::ArgTypeMismatchError(args[0].getPosStr(), ins.raw_code,
+                throw base::errors::ArgTypeMismatchError(args[0].getPosStr(), ins.rawCode(),
                                                       {"Error Arg: " + args[0].toString(),
                                                        "Expected Type: " + data::CustomInst::typeId.toString()},
                                                       {"Check whether the first data of the " + ins.ri->toString() +
@@ -3541,7 +4702,7 @@ namespace exes {
             error_index = 1;
             const auto &derive_type = tools::getArgOriginData(args[1]);
             if (!derive_type->getTypeID().fullEqualWith(data::CustomType::typeId)) {
-                throw base::errors::ArgTypeMismatchError(args[1].getPosStr(), ins.raw_code,
+                throw base::errors::ArgTypeMismatchError(args[1].getPosStr(), ins.rawCode(),
                                                       {"Error Arg: " + args[1].toString(),
                                                        "Expected Type: " + data::CustomType::typeId.toString()},
                                                       {"Check whether the second data of the " + ins.ri->toString() +
@@ -3549,7 +4710,7 @@ namespace exes {
             }
             inst_data->derivedToChildType(static_pointer_cast<data::CustomType>(derive_type));
         } catch (const base::errors::MemoryError &_) {
-            throw base::errors::MemoryError(args[error_index].getPosStr(), ins.raw_code,
+            throw base::errors::MemoryError(args[error_index].getPosStr(), ins.rawCode(),
                                             {"This error is caused by accessing memory space that does not exist.",
                                              "Nonexistent Space Name: '" + args[error_index].getValue() + "'"},
                                             { "Please use " + ris::ALLOT.toString() +
@@ -3560,7 +4721,7 @@ namespace exes {
 
     ExecutionStatus ri_sp_get(const Ins &ins, size_t &pointer, const StdArgs &args) {
         if (args[0].getType() != utils::ArgType::keyword && args[0].getType() != utils::ArgType::identifier) {
-            throw base::errors::ArgTypeMismatchError(args[0].getPosStr(), ins.raw_code,
+            throw base::errors::ArgTypeMismatchError(args[0].getPosStr(), ins.rawCode(),
                                                   {"Error Arg: " + args[0].toString(),
                                                    "Expected Type: " +
                                                    getTypeFormatString(utils::ArgType::keyword) +
@@ -3570,12 +4731,12 @@ namespace exes {
                                                    " or " +
                                                    getTypeFormatString(utils::ArgType::identifier) + "."});
         }
-        auto scopeName = data_space_pool.getCurrentScopeNoLock()->getName();
+        auto scopeName = data_space_pool().getCurrentScopeNoLock()->getName();
         try {
-            data_space_pool.updateDataByNameNoLock(args[0].getValue(),
+            data_space_pool().updateDataByNameNoLock(args[0].getSymbol(),
                                                    std::make_shared<data::String>(scopeName));
         } catch (const base::errors::MemoryError &_) {
-            throw base::errors::MemoryError(args[0].getPos().toString(), ins.raw_code,
+            throw base::errors::MemoryError(args[0].getPos().toString(), ins.rawCode(),
                                             {"This error is caused by accessing memory space that does not exist.",
                                              "Nonexistent Space Name: " + args[0].toString()},
                                             {"Use the " + ris::ALLOT.toString() +
@@ -3586,7 +4747,7 @@ namespace exes {
 
     ExecutionStatus ri_sp_set(const Ins &ins, size_t &pointer, const StdArgs &args) {
         if (args[0].getType() != utils::ArgType::keyword && args[0].getType() != utils::ArgType::identifier) {
-            throw base::errors::ArgTypeMismatchError(args[0].getPosStr(), ins.raw_code,
+            throw base::errors::ArgTypeMismatchError(args[0].getPosStr(), ins.rawCode(),
                                                   {"Error Arg: " + args[0].toString(),
                                                    "Expected Type: " +
                                                    getTypeFormatString(utils::ArgType::keyword) +
@@ -3598,9 +4759,9 @@ namespace exes {
         }
         auto data = tools::getArgOriginData(args[0]);
         try {
-            data_space_pool.setCurrentScopeByName(data->getValStr());
+            data_space_pool().setCurrentScopeByName(data->getValStr());
         } catch (const base::errors::MemoryError &_) {
-            throw base::errors::MemoryError(args[0].getPos().toString(), ins.raw_code,
+            throw base::errors::MemoryError(args[0].getPos().toString(), ins.rawCode(),
                                             {"This error is caused by the fact that the target scope of the " +
                                              ins.ri->toString() + " does not exist.",
                                              "Nonexistent Scope ID: " + args[0].toString()},
@@ -3612,7 +4773,7 @@ namespace exes {
 
     ExecutionStatus ri_sp_new(const Ins &ins, size_t &pointer, const StdArgs &args) {
         if (args[0].getType() != utils::ArgType::keyword && args[0].getType() != utils::ArgType::identifier) {
-            throw base::errors::ArgTypeMismatchError(args[0].getPosStr(), ins.raw_code,
+            throw base::errors::ArgTypeMismatchError(args[0].getPosStr(), ins.rawCode(),
                                                   {"Error Arg: " + args[0].toString(),
                                                    "Expected Type: " +
                                                    getTypeFormatString(utils::ArgType::keyword) +
@@ -3623,12 +4784,12 @@ namespace exes {
                                                    getTypeFormatString(utils::ArgType::identifier) + "."});
         }
         try {
-            auto new_scope = data_space_pool.acquireScope(pre_SP_NEW);
-            data_space_pool.updateDataByNameNoLock(args[0].getValue(),
+            auto new_scope = data_space_pool().acquireScope(pre_SP_NEW);
+            data_space_pool().updateDataByNameNoLock(args[0].getSymbol(),
                                                    std::make_shared<data::String>(
                                                            new_scope->getInstID().toString()));
         } catch (const base::errors::MemoryError &_) {
-            throw base::errors::MemoryError(args[0].getPos().toString(), ins.raw_code,
+            throw base::errors::MemoryError(args[0].getPos().toString(), ins.rawCode(),
                                             {"This error is caused by accessing memory space that does not exist.",
                                              "Nonexistent Space Name: " + args[0].toString()},
                                             {"Use the " + ris::ALLOT.toString() +
@@ -3639,7 +4800,7 @@ namespace exes {
 
     ExecutionStatus ri_sp_del(const Ins &ins, size_t &pointer, const StdArgs &args) {
         if (args[0].getType() != utils::ArgType::keyword && args[0].getType() != utils::ArgType::identifier) {
-            throw base::errors::ArgTypeMismatchError(args[0].getPosStr(), ins.raw_code,
+            throw base::errors::ArgTypeMismatchError(args[0].getPosStr(), ins.rawCode(),
                                                   {"Error Arg: " + args[0].toString(),
                                                    "Expected Type: " +
                                                    getTypeFormatString(utils::ArgType::keyword) +
@@ -3651,9 +4812,9 @@ namespace exes {
         }
         try {
             auto data = tools::getArgOriginData(args[0]);
-            data_space_pool.releaseScope(data_space_pool.findScopeByNameNoLock(data->getValStr()));
+            data_space_pool().releaseScope(data_space_pool().findScopeByNameNoLock(data->getValStr()));
         } catch (const base::errors::MemoryError &_) {
-            throw base::errors::MemoryError(args[0].getPos().toString(), ins.raw_code,
+            throw base::errors::MemoryError(args[0].getPos().toString(), ins.rawCode(),
                                             {"This error is caused by deleting memory space that does not exist.",
                                              "Nonexistent Scope ID: " + args[0].toString()},
                                             {"Use the " + ris::SP_GET.toString() + " or " + ris::SP_NEW.toString() +
@@ -3664,7 +4825,7 @@ namespace exes {
 
     ExecutionStatus ri_qot(const Ins &ins, size_t &pointer, const StdArgs &args) {
         static auto throw_error = [&ins](const utils::Arg &error_arg) {
-            throw base::errors::ArgTypeMismatchError(error_arg.getPosStr(), ins.raw_code,
+            throw base::errors::ArgTypeMismatchError(error_arg.getPosStr(), ins.rawCode(),
                                                   {"Error Arg: " + error_arg.toString(),
                                                    "Expected Type: " +
                                                    getTypeFormatString(utils::ArgType::keyword) +
@@ -3682,15 +4843,15 @@ namespace exes {
         }
         auto error_arg = args[0];
         try {
-            auto [id, data] = data_space_pool.findDataByNameNoLock(args[0].getValue());
+            auto [id, data] = data_space_pool().findDataByNameNoLock(args[0].getSymbol());
             if (!data) {
                 throw base::errors::MemoryError(unknown_, unknown_, {}, {});
             }
             error_arg = args[1];
-            data_space_pool.updateDataByNameNoLock(args[1].getValue(),
+            data_space_pool().updateDataByNameNoLock(args[1].getSymbol(),
                                                    std::make_shared<data::Quote>(id));
         } catch (const base::errors::MemoryError &_) {
-            throw base::errors::MemoryError(error_arg.getPos().toString(), ins.raw_code,
+            throw base::errors::MemoryError(error_arg.getPos().toString(), ins.rawCode(),
                                             {"This error is caused by accessing memory space that does not exist.",
                                              "Nonexistent Space Name: " + error_arg.toString()},
                                             {"Use the " + ris::ALLOT.toString() +
@@ -3701,7 +4862,7 @@ namespace exes {
 
     ExecutionStatus ri_qot_val(const Ins &ins, size_t &pointer, const StdArgs &args) {
         if (args[1].getType() != utils::ArgType::keyword && args[1].getType() != utils::ArgType::identifier) {
-            throw base::errors::ArgTypeMismatchError(args[1].getPosStr(), ins.raw_code,
+            throw base::errors::ArgTypeMismatchError(args[1].getPosStr(), ins.rawCode(),
                                                   {"Error Arg: " + args[1].toString(),
                                                    "Expected Type: " +
                                                    getTypeFormatString(utils::ArgType::keyword) +
@@ -3714,12 +4875,12 @@ namespace exes {
 
         try {
             auto data = tools::getArgNewData(args[0]);
-            auto [id, quote_data] = data_space_pool.findDataByNameNoLock(args[1].getValue());
+            auto [id, quote_data] = data_space_pool().findDataByNameNoLock(args[1].getSymbol());
             if (!quote_data) {
                 throw base::errors::MemoryError(unknown_, unknown_, {}, {});
             }
             if (quote_data->getTypeID() != data::Quote::typeId) {
-                throw base::errors::ArgTypeMismatchError(args[1].getPosStr(), ins.raw_code,
+                throw base::errors::ArgTypeMismatchError(args[1].getPosStr(), ins.rawCode(),
                                                       {"Error Arg: " + args[1].toString(),
                                                        "Expected Type: " + data::Quote::typeId.toString()},
                                                       {"Check whether the first data of the " +
@@ -3729,7 +4890,7 @@ namespace exes {
             }
             static_pointer_cast<data::Quote>(quote_data)->updateQuoteData(data);
         } catch (const base::errors::MemoryError &_) {
-            throw base::errors::MemoryError(args[1].getPos().toString(), ins.raw_code,
+            throw base::errors::MemoryError(args[1].getPos().toString(), ins.rawCode(),
                                             {"This error is caused by accessing memory space that does not exist.",
                                              "Nonexistent Space Name: " + args[1].toString()},
                                             {"Use the " + ris::ALLOT.toString() +
@@ -3741,16 +4902,21 @@ namespace exes {
     ExecutionStatus ri_ret(const Ins &ins, size_t &pointer, const StdArgs &args) {
         if (args.size() > 1) {
             throw base::errors::ArgumentNumberError(
-                args[args.size() - 1].getPosStr(), ins.raw_code, "0 / 1",
+                args[args.size() - 1].getPosStr(), ins.rawCode(), "0 / 1",
                 args.size(), ins.ri->toString(), {});
         }
         try {
             if (args.size() == 1) {
-                data_space_pool.updateDataNoLock(SR_SpaceID, tools::getArgNewData(args[0]));
+                auto value = tools::getArgNewData(args[0]);
+                if (auto &registers = ExecutionState::current().return_registers; registers.empty()) {
+                    writeCompatibleReturnValue(value);
+                } else {
+                    registers.back() = std::move(value);
+                }
             }
             return ExecutionStatus::AbortedFunction;
         } catch (const base::errors::MemoryError &_) {
-            throw base::errors::MemoryError(args[0].getPos().toString(), ins.raw_code,
+            throw base::errors::MemoryError(args[0].getPos().toString(), ins.rawCode(),
                                             {"This error is caused by accessing memory space that does not exist.",
                                              "Nonexistent Space Name: " + args[0].toString()},
                                             {"Use the " + ris::ALLOT.toString() +
@@ -3761,19 +4927,22 @@ namespace exes {
 
     ExecutionStatus ri_pow(const Ins &ins, size_t &pointer, const StdArgs &args) {
         if (args[2].getType() != utils::ArgType::identifier && args[2].getType() != utils::ArgType::keyword) {
-            throw base::errors::ArgTypeMismatchError(args[2].getPos().toString(), ins.raw_code,
+            throw base::errors::ArgTypeMismatchError(args[2].getPos().toString(), ins.rawCode(),
                                                   {"Error Arg: " + args[2].toString(),
                                                    "Expected Type: " +
                                                    getTypeFormatString(utils::ArgType::identifier) +
                                                    " or " + getTypeFormatString(utils::ArgType::keyword)},
                                                   {"Check the type of the target argument of the " +
                                                    ins.ri->toString() + "."});
-            return ExecutionStatus::FailedWithError;
         }
+        return ri_pow_unchecked(ins, pointer, args);
+    }
+
+    ExecutionStatus ri_pow_unchecked(const Ins &ins, [[maybe_unused]] size_t &pointer, const StdArgs &args) {
         const auto &data1 = tools::getArgNewData(args[0]);
         const auto &data2 = tools::getArgNewData(args[1]);
         if (!tools::isNumericData(data1)) {
-            throw base::errors::ArgTypeMismatchError(args[0].getPos().toString(), ins.raw_code,
+            throw base::errors::ArgTypeMismatchError(args[0].getPos().toString(), ins.rawCode(),
                                                   {"Error Data: " + utils::getSpaceFormatString(args[0].getValue(),
                                                                                                 data1->toString()),
                                                    "Expected Type: " + data::Numeric::typeId.toString()},
@@ -3782,7 +4951,7 @@ namespace exes {
                                                    "."});
         }
         if (!tools::isNumericData(data2)) {
-            throw base::errors::ArgTypeMismatchError(args[1].getPos().toString(), ins.raw_code,
+            throw base::errors::ArgTypeMismatchError(args[1].getPos().toString(), ins.rawCode(),
                                                   {"Error Data: " + utils::getSpaceFormatString(args[1].getValue(),
                                                                                                 data2->toString()),
                                                    "Expected Type: " + data::Numeric::typeId.toString()},
@@ -3791,11 +4960,17 @@ namespace exes {
                                                    "."});
         }
         try {
-            data_space_pool.updateDataByNameNoLock(args[2].getValue(),
+            if (executeArithmeticInPlace(args[2].getSymbol(), data1, data2,
+                                         [](const auto &base, const auto &exponent) {
+                                             return std::pow(base, exponent);
+                                         })) {
+                return ExecutionStatus::Success;
+            }
+            data_space_pool().updateDataByNameNoLock(args[2].getSymbol(),
                                                    static_pointer_cast<data::Numeric>(data1)->pow(
                                                            static_pointer_cast<data::Numeric>(data2)));
         } catch (const base::errors::MemoryError &_) {
-            throw base::errors::MemoryError(args[2].getPos().toString(), ins.raw_code,
+            throw base::errors::MemoryError(args[2].getPos().toString(), ins.rawCode(),
                                             {"This error is caused by accessing memory space that does not exist.",
                                              "Nonexistent Space Name: " + args[2].toString()},
                                             {"Use the " + ris::ALLOT.toString() +
@@ -3806,19 +4981,22 @@ namespace exes {
 
     ExecutionStatus ri_root(const Ins &ins, size_t &pointer, const StdArgs &args) {
         if (args[2].getType() != utils::ArgType::identifier && args[2].getType() != utils::ArgType::keyword) {
-            throw base::errors::ArgTypeMismatchError(args[2].getPos().toString(), ins.raw_code,
+            throw base::errors::ArgTypeMismatchError(args[2].getPos().toString(), ins.rawCode(),
                                                   {"Error Arg: " + args[2].toString(),
                                                    "Expected Type: " +
                                                    getTypeFormatString(utils::ArgType::identifier) +
                                                    " or " + getTypeFormatString(utils::ArgType::keyword)},
                                                   {"Check the type of the target argument of the " +
                                                    ins.ri->toString() + "."});
-            return ExecutionStatus::FailedWithError;
         }
+        return ri_root_unchecked(ins, pointer, args);
+    }
+
+    ExecutionStatus ri_root_unchecked(const Ins &ins, [[maybe_unused]] size_t &pointer, const StdArgs &args) {
         const auto &data1 = tools::getArgNewData(args[0]);
         const auto &data2 = tools::getArgNewData(args[1]);
         if (!tools::isNumericData(data1)) {
-            throw base::errors::ArgTypeMismatchError(args[0].getPos().toString(), ins.raw_code,
+            throw base::errors::ArgTypeMismatchError(args[0].getPos().toString(), ins.rawCode(),
                                                   {"Error Data: " + utils::getSpaceFormatString(args[0].getValue(),
                                                                                                 data1->toString()),
                                                    "Expected Type: " + data::Numeric::typeId.toString()},
@@ -3827,7 +5005,7 @@ namespace exes {
                                                    "."});
         }
         if (!tools::isNumericData(data2)) {
-            throw base::errors::ArgTypeMismatchError(args[1].getPos().toString(), ins.raw_code,
+            throw base::errors::ArgTypeMismatchError(args[1].getPos().toString(), ins.rawCode(),
                                                   {"Error Data: " + utils::getSpaceFormatString(args[1].getValue(),
                                                                                                 data2->toString()),
                                                    "Expected Type: " + data::Numeric::typeId.toString()},
@@ -3836,11 +5014,17 @@ namespace exes {
                                                    "."});
         }
         try {
-            data_space_pool.updateDataByNameNoLock(args[2].getValue(),
+            if (executeArithmeticInPlace(args[2].getSymbol(), data1, data2,
+                                         [](const auto &radicand, const auto &degree) {
+                                             return std::pow(radicand, 1.0 / degree);
+                                         })) {
+                return ExecutionStatus::Success;
+            }
+            data_space_pool().updateDataByNameNoLock(args[2].getSymbol(),
                                                    static_pointer_cast<data::Numeric>(data1)->root(
                                                            static_pointer_cast<data::Numeric>(data2)));
         } catch (const base::errors::MemoryError &_) {
-            throw base::errors::MemoryError(args[2].getPos().toString(), ins.raw_code,
+            throw base::errors::MemoryError(args[2].getPos().toString(), ins.rawCode(),
                                             {"This error is caused by accessing memory space that does not exist.",
                                              "Nonexistent Space Name: " + args[2].toString()},
                                             {"Use the " + ris::ALLOT.toString() +
@@ -3851,19 +5035,22 @@ namespace exes {
 
     ExecutionStatus ri_mod(const Ins &ins, size_t &pointer, const StdArgs &args) {
         if (args[2].getType() != utils::ArgType::identifier && args[2].getType() != utils::ArgType::keyword) {
-            throw base::errors::ArgTypeMismatchError(args[2].getPos().toString(), ins.raw_code,
+            throw base::errors::ArgTypeMismatchError(args[2].getPos().toString(), ins.rawCode(),
                                                   {"Error Arg: " + args[2].toString(),
                                                    "Expected Type: " +
                                                    getTypeFormatString(utils::ArgType::identifier) +
                                                    " or " + getTypeFormatString(utils::ArgType::keyword)},
                                                   {"Check the type of the target argument of the " +
                                                    ins.ri->toString() + "."});
-            return ExecutionStatus::FailedWithError;
         }
+        return ri_mod_unchecked(ins, pointer, args);
+    }
+
+    ExecutionStatus ri_mod_unchecked(const Ins &ins, [[maybe_unused]] size_t &pointer, const StdArgs &args) {
         const auto &data1 = tools::getArgNewData(args[0]);
         const auto &data2 = tools::getArgNewData(args[1]);
         if (!tools::isNumericData(data1)) {
-            throw base::errors::ArgTypeMismatchError(args[0].getPos().toString(), ins.raw_code,
+            throw base::errors::ArgTypeMismatchError(args[0].getPos().toString(), ins.rawCode(),
                                                   {"Error Data: " + utils::getSpaceFormatString(args[0].getValue(),
                                                                                                 data1->toString()),
                                                    "Expected Type: " + data::Numeric::typeId.toString()},
@@ -3872,7 +5059,7 @@ namespace exes {
                                                    "."});
         }
         if (!tools::isNumericData(data2)) {
-            throw base::errors::ArgTypeMismatchError(args[1].getPos().toString(), ins.raw_code,
+            throw base::errors::ArgTypeMismatchError(args[1].getPos().toString(), ins.rawCode(),
                                                   {"Error Data: " + utils::getSpaceFormatString(args[1].getValue(),
                                                                                                 data2->toString()),
                                                    "Expected Type: " + data::Numeric::typeId.toString()},
@@ -3881,11 +5068,14 @@ namespace exes {
                                                    "."});
         }
         try {
-            data_space_pool.updateDataByNameNoLock(args[2].getValue(),
+            if (executeArithmeticInPlace(args[2].getSymbol(), data1, data2, Modulo(), NonZeroDivisor())) {
+                return ExecutionStatus::Success;
+            }
+            data_space_pool().updateDataByNameNoLock(args[2].getSymbol(),
                                                    static_pointer_cast<data::Numeric>(data1)->mod(
                                                            static_pointer_cast<data::Numeric>(data2)));
         } catch (const base::errors::MemoryError &_) {
-            throw base::errors::MemoryError(args[2].getPos().toString(), ins.raw_code,
+            throw base::errors::MemoryError(args[2].getPos().toString(), ins.rawCode(),
                                             {"This error is caused by accessing memory space that does not exist.",
                                              "Nonexistent Space Name: " + args[2].toString()},
                                             {"Use the " + ris::ALLOT.toString() +
@@ -3895,67 +5085,30 @@ namespace exes {
     }
 
     ExecutionStatus ri_atmp(const Ins &ins, size_t &pointer, const StdArgs &args) {
-        // ʼҪı
-        std::shared_ptr<InsSet> atmp_block_ins_set = std::make_shared<InsSet>("ATMP");
-        std::shared_ptr<InsSet> finally_ins_set = std::make_shared<InsSet>("FINALLY");
-        std::vector<std::shared_ptr<DetectBlock>> detect_blocks;
-        bool has_detect = false;
-
-        // ָ
-        for (const auto &inner_ins: ins.scopeInsSet->getInsSet()) {
-            if (ris::DETECT.equalWith(inner_ins->ri)) {
-                //  DETECT ָ
-                if (!has_detect) {
-                    has_detect = true; // ѽ DETECT 
-                }
-
-                // ǷϷ
-                const auto &arg0 = inner_ins->args[0];
-                if (arg0.getType() != utils::ArgType::identifier && arg0.getType() != utils::ArgType::keyword) {
-                    throw base::errors::ArgTypeMismatchError(
-                            arg0.getPos().toString(), ins.raw_code,
-                            {"Error Arg: " + arg0.toString(),
-                             "Expected Type: " + getTypeFormatString(utils::ArgType::identifier) +
-                             " or " + getTypeFormatString(utils::ArgType::keyword)},
-                            {"Check the type of the target argument of the " + ris::DETECT.toString() + "."});
-                }
-
-                // ȡͲ DetectBlock
-                auto detect_type = tools::getArgOriginData(inner_ins->args[0]);
-                if (detect_type->getTypeID() != data::CustomType::typeId) {
-                    throw base::errors::ArgTypeMismatchError(
-                            arg0.getPos().toString(), ins.raw_code,
-                            {"Error Data: " + utils::getSpaceFormatString(arg0.getValue(),
-                                                                          detect_type->toString()),
-                             "Expected Type: " + data::CustomType::typeId.toString()},
-                            {"Check the type of the target argument of the " + ris::DETECT.toString() + "."});
-                }
-                detect_blocks.emplace_back(std::make_shared<DetectBlock>(
-                        static_pointer_cast<data::CustomType>(detect_type),
-                        inner_ins->args[1], inner_ins->scopeInsSet));
-            } else if (!has_detect) {
-                // δ DETECT 飬ָӵ atmp_block_ins_set
-                atmp_block_ins_set->addIns(inner_ins);
-            } else {
-                // ѽ DETECT 飬ָӵ finally_ins_set
-                finally_ins_set->addIns(inner_ins);
-            }
-        }
-
-        //  AtmpBlock ִ
-        const auto &atmp_block = std::make_shared<AtmpBlock>(detect_blocks, atmp_block_ins_set, finally_ins_set);
-        InsSet::atmp_stack.push_back(atmp_block);
-        atmp_block_ins_set->setScopeLeader(ins);
-        data_space_pool.acquireScope(atmp_block->block_ins_set->scope_prefix);
+        // ͨڼʱ InsSet::verify ֣δУָ״ִʱ
+        auto &atmp_layout = ins.cached<AtmpLayout>();
+        if (!atmp_layout) {
+            atmp_layout = AtmpLayout::split(ins);
+        }
+        // ״ִʱһΣ֮ÿִֻѹһִ״̬
+        if (!atmp_layout->detect_resolved) {
+            atmp_layout->resolveDetectTypes(ins);
+        }
+        const auto &atmp_block_ins_set = atmp_layout->attempt_ins_set;
+        const auto &finally_ins_set = atmp_layout->finally_ins_set;
+        // ѹ뱾ִ״ִ̬
+        auto &atmp_stack = ExecutionState::current().atmp_stack;
+        atmp_stack.push_back({atmp_layout.get()});
+        data_space_pool().acquireScope(atmp_block_ins_set->scope_prefix);
         const auto &exe_res = atmp_block_ins_set->execute();
         finally_ins_set->execute();
-        InsSet::atmp_stack.pop_back();
-        if (atmp_block->is_hit) {
-            const auto detect_scope = data_space_pool.acquireScope(
-                    atmp_block->hit_detect_block->block_ins_set->scope_prefix);
-            data_space_pool.addData(atmp_block->hit_detect_block->error_stored_arg.getValue(),
-                                    atmp_block->hit_detect_block->error_data);
-            return atmp_block->hit_detect_block->block_ins_set->execute();
+        const AtmpBlock atmp_block = std::move(atmp_stack.back());
+        atmp_stack.pop_back();
+        if (const auto *hit_detect_block = atmp_block.hit_detect_block) {
+            const auto detect_scope = data_space_pool().acquireScope(
+                    hit_detect_block->block_ins_set->scope_prefix);
+            data_space_pool().addData(hit_detect_block->error_stored_arg.getValue(), atmp_block.error_data);
+            return hit_detect_block->block_ins_set->execute();
         }
         return exe_res;
     }
@@ -3963,7 +5116,7 @@ namespace exes {
     ExecutionStatus ri_expose(const Ins &ins, size_t &pointer, const StdArgs &args) {
         const auto &argData = tools::getArgOriginData(args[0]);
         if (argData->getTypeID() != data::CustomInst::typeId) {
-            throw base::errors::ArgTypeMismatchError(args[0].getPos().toString(), ins.raw_code,
+            throw base::errors::ArgTypeMismatchError(args[0].getPos().toString(), ins.rawCode(),
                                                   {"Error Data: " + utils::getSpaceFormatString(args[0].getValue(),
                                                                                                 argData->toString()),
                                                    "Expected Type: " + data::CustomInst::typeId.toString()},
@@ -3972,16 +5125,16 @@ namespace exes {
         }
         auto expose_inst = static_pointer_cast<data::CustomInst>(argData);
         auto error_data = std::make_shared<data::Error>(
-                ins.pos.toString(), ins.raw_code,
+                ins.pos.toString(), ins.rawCode(),
                 std::vector<std::string>{expose_inst->getValStr()});
-        data_space_pool.updateDataByNameNoLock("SE", error_data);
-        data_space_pool.updateDataByNameNoLock("_SE", error_data);
-        for (auto atmp = InsSet::atmp_stack.rbegin(); atmp != InsSet::atmp_stack.rend(); ++atmp) {
-            for (auto &detect_block: (*atmp)->detect_blocks) {
-                if (expose_inst->customType->checkBelongTo(detect_block->detected_type)) {
-                    detect_block->error_data = expose_inst;
-                    (*atmp)->is_hit = true;
-                    (*atmp)->hit_detect_block = detect_block;
+        data_space_pool().updateDataByNameNoLock("SE", error_data);
+        data_space_pool().updateDataByNameNoLock("_SE", error_data);
+        auto &atmp_stack = ExecutionState::current().atmp_stack;
+        for (auto atmp = atmp_stack.rbegin(); atmp != atmp_stack.rend(); ++atmp) {
+            for (const auto &detect_block: atmp->layout->detect_blocks) {
+                if (expose_inst->customType->checkBelongTo(detect_block.detected_type)) {
+                    atmp->error_data = expose_inst;
+                    atmp->hit_detect_block = &detect_block;
                     ri_exit(ins, pointer, args);
                     return ExecutionStatus::ExposedError;
                 }
@@ -3994,14 +5147,14 @@ namespace exes {
         // ǷϷ
         if (args.empty() || args.size() > 2) {
             throw base::errors::ArgumentNumberError(
-                    ins.pos.toString(), ins.raw_code, "1 / 2",
+                    ins.pos.toString(), ins.rawCode(), "1 / 2",
                     static_cast<int>(args.size()), ins.ri->toString(), {});
         }
 
         // ȡ֤һļ·
         auto filePathData = tools::getArgOriginData(args[0]);
         if (filePathData->getTypeID() != data::String::typeId) {
-            throw base::errors::ArgTypeMismatchError(args[0].getPos().toString(), ins.raw_code,
+            throw base::errors::ArgTypeMismatchError(args[0].getPos().toString(), ins.rawCode(),
                                                   {"Error Data: " + utils::getSpaceFormatString(args[0].getValue(),
                                                                                                 filePathData->toString()),
                                                    "Expected Type: " + data::String::typeId.toString()},
@@ -4011,7 +5164,7 @@ namespace exes {
         // ļ·
         const std::string& filePath = utils::getAbsolutePath(
                 static_pointer_cast<data::String>(filePathData)->getValStr(),
-                base::PROGRAM_WORKING_DIRECTORY_STACK.top());
+                base::getProgramWorkingDirectoryStack().top());
 
         // Ƿṩչ洢
         const bool hasExtensionStore = (args.size() == 2);
@@ -4023,15 +5176,18 @@ namespace exes {
         // ļչǷѴ
         auto [extensionExists, extensionUnicPath] = tools::checkExtensionExist(filePath);
 
-        if (extensionExists) {
+        // ѼصչֱӸãǰޱʶʽأ LINKչûж贴µչʵ
+        const auto &existingExtension = extensionExists ? data_space_pool().loaded_extensions[extensionUnicPath] : nullptr;
+        if (extensionExists && (existingExtension || !hasExtensionStore)) {
             // չѴṩ˴洢
             if (hasExtensionStore) {
-                const auto& existingExtension = memory::loadedExtensions[extensionUnicPath];
                 if (!extensionData) {
-                    const auto &_ = data_space_pool.addGlobalData(args[1].getValue(), existingExtension);
+                    const auto &_ = data_space_pool().addGlobalData(args[1].getValue(), existingExtension);
                 } else {
-                    data_space_pool.updateDataByNameNoLock(args[1].getValue(), existingExtension);
+                    data_space_pool().updateDataByNameNoLock(args[1].getSymbol(), existingExtension);
                 }
+                ExtFieldCache::bind(*ExecutionState::current().exe_stack.top(), args[1].getSymbol(),
+                                    existingExtension);
             }
             return ExecutionStatus::Success;
         }
@@ -4039,33 +5195,33 @@ namespace exes {
         // µչӵݳ
         std::shared_ptr<data::Extension> newExtension = nullptr;
         if (hasExtensionStore) {
-            newExtension = std::make_shared<data::Extension>(args[1].getValue(), filePath);
+            newExtension = std::make_shared<data::Extension>(args[1].getValue(), extensionUnicPath);
             if (!extensionData) {
-                const auto &_ = data_space_pool.addGlobalData(args[1].getValue(), newExtension);
+                const auto &_ = data_space_pool().addGlobalData(args[1].getValue(), newExtension);
             } else {
-                data_space_pool.updateDataByNameNoLock(args[1].getValue(), newExtension);
+                data_space_pool().updateDataByNameNoLock(args[1].getSymbol(), newExtension);
             }
+            ExtFieldCache::bind(*ExecutionState::current().exe_stack.top(), args[1].getSymbol(), newExtension);
         }
 
         // չӵѼչб
-        memory::loadedExtensions.emplace(extensionUnicPath, newExtension);
+        data_space_pool().loaded_extensions.insert_or_assign(extensionUnicPath, newExtension);
 
         try {
-            // ִļеĴ
-            const auto& instructionSet = parser::parse::parseCodeFromPath(
-                    filePath, false,
-                    hasExtensionStore ? args[1].getValue() : "");
+            // ȡչļĶָִгʼ룻ʶʱָչ·չ·չ
+            const auto& instructionSet = parser::parse::ExtensionCache::getInstance().acquire(
+                    extensionUnicPath, hasExtensionStore);
             instructionSet->execute();
 
             // ṩ˴洢Ƴǰ
             if (hasExtensionStore) {
-                data_space_pool.removeScopeNoLock(newExtension->extension_scope);
+                data_space_pool().removeScopeNoLock(newExtension->extension_scope);
             }
         } catch ([[maybe_unused]] const base::errors::FileReadError &e) {
             // ׳ļȡӸϢ
-            throw base::errors::FileReadError(ins.pos.toString(), ins.raw_code,
+            throw base::errors::FileReadError(ins.pos.toString(), ins.rawCode(),
                                               {"Error file path: " + utils::getEscapedPathFormatString(filePath),
-                                               "Program entry directory: " + utils::getEscapedPathFormatString(base::PROGRAM_WORKING_DIRECTORY_STACK.top())},
+                                               "Program entry directory: " + utils::getEscapedPathFormatString(base::getProgramWorkingDirectoryStack().top())},
                                               {"Please check if the provided file exists or is correct."});
         }
 
@@ -4083,8 +5239,7 @@ namespace exes {
             rasm_str += tools::getArgOriginData(arg)->getValStr();
         }
         try{
-            parser::parse::parseCode(parser::parse::ParseType::Rasm, ins.pos.getFilepath(), rasm_str,
-                                     false, ins.pos, "")->execute();
+            parser::parse::RasmCache::getInstance().acquire(ins.pos.getFilepath(), rasm_str, ins.pos)->execute();
         }catch (base::RVM_Error &e){
             e.error_position = args[args.size() - 1].getPosStr();
             throw;
@@ -4095,21 +5250,39 @@ namespace exes {
     ExecutionStatus ri_ext_get(const Ins &ins, size_t &pointer, const StdArgs &args) {
         auto error_arg = args[0];
         try {
+            // ͨڼʱ InsSet::verify δУָ״ִʱ
+            auto &cache = ins.cached<ExtFieldCache>();
+            if (!cache) {
+                cache = ExtFieldCache::build(ins);
+            }
             const auto &ext = tools::getArgOriginData(args[0]);
-            error_arg = args[1];
-            const auto &field = tools::getArgOriginData(args[1]);
+            std::shared_ptr<base::RVM_Data> res_data = nullptr;
 
-            tools::checkArgumentDataTypeAndRet<data::Extension>(ext, ins, args[0], 1);
-            tools::checkArgumentDataTypeAndRet<data::String>(field, ins, args[1], 2);
-
-            const auto &res_data = static_pointer_cast<data::Extension>(ext)->extension_scope
-                    ->findDataByName(field->getValStr());
+            // ·ֶչ󶨵չͬݰ汾δ仯
+            if (cache->literal_field && ext == cache->extension &&
+                cache->epoch == cache->extension->extension_scope->getEpoch()) {
+                res_data = cache->data.lock();
+            }
+            if (!res_data) {
+                error_arg = args[1];
+                tools::checkArgumentDataTypeAndRet<data::Extension>(ext, ins, args[0], 1);
+                if (!cache->literal_field) {
+                    const auto &field = tools::getArgOriginData(args[1]);
+                    tools::checkArgumentDataTypeAndRet<data::String>(field, ins, args[1], 2);
+                    cache->field = field->getValStr();
+                }
+                auto extension = static_pointer_cast<data::Extension>(ext);
+                res_data = extension->extension_scope->findDataByName(cache->field);
+                cache->epoch = extension->extension_scope->getEpoch();
+                cache->extension = std::move(extension);
+                cache->data = res_data;
+            }
 
             error_arg = args[2];
-            data_space_pool.updateDataByNameNoLock(
+            data_space_pool().updateDataByNameNoLock(
                     args[2].getValue(), res_data);
         } catch (const base::errors::MemoryError&) {
-            throw base::errors::MemoryError(error_arg.getPosStr(), ins.raw_code,
+            throw base::errors::MemoryError(error_arg.getPosStr(), ins.rawCode(),
                                             {"This error is caused by manipulating memory space that does not exist.",
                                              "Nonexistent Space Name: " + error_arg.toString()},
                                             {"Use the " + ris::ALLOT.toString() +
@@ -4128,7 +5301,7 @@ namespace exes {
         const auto &pair_data = std::make_shared<data::KeyValuePair>(key_data, value_data);
         if (const auto &target_data = tools::getArgOriginData(args[2]);
             !target_data->updateData(pair_data)) {
-            data_space_pool.updateDataByNameNoLock(args[2].getValue(), pair_data);
+            data_space_pool().updateDataByNameNoLock(args[2].getSymbol(), pair_data);
         }
         return ExecutionStatus::Success;
     }
@@ -4166,7 +5339,7 @@ namespace exes {
                 tools::getArgOriginData(args[0]),
                 ins, args[0], 1, true);
         if (! tools::getArgOriginData(args[1])->updateData(pair_data->getKey())) {
-            data_space_pool.updateDataByNameNoLock(args[1].getValue(), pair_data->getKey());
+            data_space_pool().updateDataByNameNoLock(args[1].getSymbol(), pair_data->getKey());
         }
         return ExecutionStatus::Success;
     }
@@ -4180,7 +5353,7 @@ namespace exes {
                 tools::getArgOriginData(args[0]),
                 ins, args[0], 1, true);
         if (! tools::getArgOriginData(args[1])->updateData(pair_data->getValue())) {
-            data_space_pool.updateDataByNameNoLock(args[1].getValue(), pair_data->getValue());
+            data_space_pool().updateDataByNameNoLock(args[1].getSymbol(), pair_data->getValue());
         }
         return ExecutionStatus::Success;
     }
@@ -4207,10 +5380,10 @@ namespace exes {
             !tools::getArgOriginData(args[1])->updateData(value_data)) {
             try
             {
-                data_space_pool.updateDataByNameNoLock(args[2].getValue(), value_data);
+                data_space_pool().updateDataByNameNoLock(args[2].getSymbol(), value_data);
             } catch (const base::errors::MemoryError &)
             {
-                throw base::errors::MemoryError(args[2].getPosStr(), ins.raw_code,
+                throw base::errors::MemoryError(args[2].getPosStr(), ins.rawCode(),
                                                 {"This error is caused by manipulating memory space that does not exist.",
                                                  "Nonexistent Space Name: " + args[2].toString()},
                                                 {"Use the " + ris::ALLOT.toString() +
@@ -4238,11 +5411,11 @@ namespace exes {
             ins, args[0], 1, true);
         try
         {
-            data_space_pool.updateDataByNameNoLock(args[1].getValue(),
+            data_space_pool().updateDataByNameNoLock(args[1].getSymbol(),
                dictData->getKeyDataList());
         } catch (const base::errors::MemoryError &)
         {
-            throw base::errors::MemoryError(args[1].getPosStr(), ins.raw_code,
+            throw base::errors::MemoryError(args[1].getPosStr(), ins.rawCode(),
                                             {"This error is caused by manipulating memory space that does not exist.",
                                              "Nonexistent Space Name: " + args[1].toString()},
                                             {"Use the " + ris::ALLOT.toString() +
@@ -4258,11 +5431,11 @@ namespace exes {
             ins, args[0], 1, true);
         try
         {
-            data_space_pool.updateDataByNameNoLock(args[1].getValue(),
+            data_space_pool().updateDataByNameNoLock(args[1].getSymbol(),
                dictData->getValueDataList());
         } catch (const base::errors::MemoryError &)
         {
-            throw base::errors::MemoryError(args[1].getPosStr(), ins.raw_code,
+            throw base::errors::MemoryError(args[1].getPosStr(), ins.rawCode(),
                                             {"This error is caused by manipulating memory space that does not exist.",
                                              "Nonexistent Space Name: " + args[1].toString()},
                                             {"Use the " + ris::ALLOT.toString() +
@@ -4270,4 +5443,70 @@ namespace exes {
         }
         return ExecutionStatus::Success;
     }
+
+    ExecutionStatus ri_memo(const Ins &ins, [[maybe_unused]] size_t &pointer, const StdArgs &args) {
+        if (args.size() > 2 || args.size() < 1) {
+            throw base::errors::ArgumentNumberError(args[0].getPosStr(), ins.rawCode(), "1 / 2", args.size(),
+                                                    ins.ri->toString(), {});
+        }
+        const auto &function = tools::checkArgumentDataTypeAndRet<data::RetFunction>(
+                tools::processQuoteData(tools::getArgOriginData(args[0])), ins, args[0], 1, true);
+        auto capacity = MemoTable::DEFAULT_CAPACITY;
+        if (args.size() == 2) {
+            const auto &capacity_data = tools::checkArgumentDataTypeAndRet<data::Int>(
+                    tools::getArgOriginData(args[1]), ins, args[1], 2, true);
+            if (capacity_data->getValue() < 0) {
+                throw base::RVM_Error(base::ErrorType::ValueError, args[1].getPosStr(), ins.rawCode(),
+                                      {"The capacity of the memo table cannot be negative.",
+                                       "Error Arg: " + utils::getSpaceFormatString(
+                                               args[1].getValue(), capacity_data->toString())},
+                                      {"Use a positive capacity, or 0 to disable caching."});
+            }
+            capacity = static_cast<size_t>(capacity_data->getValue());
+        }
+        if (const auto &memo_table = function->func_body->memo_table) {
+            memo_table->setCapacity(capacity);
+        } else {
+            function->func_body->memo_table = MemoTable::create(function->func_name, capacity);
+        }
+        return ExecutionStatus::Success;
+    }
+
+    ExecutionStatus ri_memo_clr(const Ins &ins, [[maybe_unused]] size_t &pointer, const StdArgs &args) {
+        const auto &function = tools::checkArgumentDataTypeAndRet<data::RetFunction>(
+                tools::processQuoteData(tools::getArgOriginData(args[0])), ins, args[0], 1, true);
+        if (const auto &memo_table = function->func_body->memo_table) {
+            memo_table->clear();
+        }
+        return ExecutionStatus::Success;
+    }
+
+    ExecutionStatus executeContainerLiteral(const Ins &ins, const StdArgs &args, const bool is_dict) {
+        const auto &target_arg = args[args.size() - 1];
+        tools::checkArgumentType(ins, target_arg, static_cast<int>(args.size()),
+                                 {utils::ArgType::identifier, utils::ArgType::keyword});
+        auto &constant_container = ins.cached<ConstantContainer>();
+        if (!constant_container) {
+            constant_container = ConstantContainer::build(ins, is_dict);
+        }
+        try {
+            data_space_pool().updateDataByNameNoLock(target_arg.getSymbol(),
+                                                   constant_container->instantiate(is_dict));
+        } catch (const base::errors::MemoryError &) {
+            throw base::errors::MemoryError(target_arg.getPosStr(), ins.rawCode(),
+                                            {"This error is caused by manipulating memory space that does not exist.",
+                                             "Nonexistent Space Name: " + target_arg.toString()},
+                                            {"Use the " + ris::ALLOT.toString() +
+                                             " to manually allocate a named memory space before manipulating it."});
+        }
+        return ExecutionStatus::Success;
+    }
+
+    ExecutionStatus ri_list_lit(const Ins &ins, [[maybe_unused]] size_t &pointer, const StdArgs &args) {
+        return executeContainerLiteral(ins, args, false);
+    }
+
+    ExecutionStatus ri_dict_lit(const Ins &ins, [[maybe_unused]] size_t &pointer, const StdArgs &args) {
+        return executeContainerLiteral(ins, args, true);
+    }
 }